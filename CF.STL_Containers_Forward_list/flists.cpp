@@ -18,11 +18,33 @@
 #include <memory>
 #include <type_traits>
 #include <forward_list>
+#include <iterator>
+#include <utility>
+#include <initializer_list>
 #include <span>
 #include <array>
 #include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <optional>
+#include <exception>
+#include <tuple>
+#include <random>
+#include <functional>
+#include <future>
+#include <condition_variable>
+#include <queue>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdint>
+#include <chrono>
+#include <sstream>
+#include <fstream>
+#include <limits>
 #include <cassert>
 #include <cstddef>
+#include <cmath>
 
 using namespace std::literals::string_literals;
 
@@ -52,6 +74,14 @@ auto const dot = delimiter('.');
 //  MARK: - Function Prototype.
 auto C_forward_list(int argc, const char * argv[]) -> decltype(argc);
 auto C_forward_list_deduction_guides(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_tail_list(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_work_stealing(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_parallel_erase(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_indexed_list(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_external_sort(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_static_list(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_batch_publish(int argc, const char * argv[]) -> decltype(argc);
+auto C_forward_list_regression(int argc, const char * argv[]) -> decltype(argc);
 
 //  MARK: - Implementation.
 //  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
@@ -62,9 +92,23 @@ int main(int argc, const char * argv[]) {
   std::cout << "CF.STL_Containers_Forward_list\n";
   std::cout << "C++ Version: "s << __cplusplus << std::endl;
 
+  //  the examples take no arguments; any argument (--regress or one of the
+  //  harness options) runs the regression harness, which rejects the rest.
+  if (argc > 1) {
+    std::cout << '\n' << konst::dlm << std::endl;
+    return C_forward_list_regression(argc, argv);
+  }
+
   std::cout << '\n' << konst::dlm << std::endl;
   C_forward_list(argc, argv);
   C_forward_list_deduction_guides(argc, argv);
+  C_forward_list_tail_list(argc, argv);
+  C_forward_list_work_stealing(argc, argv);
+  C_forward_list_parallel_erase(argc, argv);
+  C_forward_list_indexed_list(argc, argv);
+  C_forward_list_external_sort(argc, argv);
+  C_forward_list_static_list(argc, argv);
+  C_forward_list_batch_publish(argc, argv);
 
   return 0;
 }
@@ -75,8 +119,16 @@ int main(int argc, const char * argv[]) {
 //  MARK: namespace cflc
 namespace cflc {
 
-template<typename T>
-std::ostream& operator<<(std::ostream & os, const std::forward_list<T> & vlst) {
+//  std::forward_list and the cflc lists shaped like it.
+template<typename List>
+concept forward_list_like = requires (List const & lst) {
+  lst.before_begin();
+  lst.begin();
+  lst.end();
+};
+
+template<forward_list_like List>
+std::ostream& operator<<(std::ostream & os, const List & vlst) {
   os.put('[');
   char comma[3] = { '\0', ' ', '\0' };
   for (const auto & el : vlst) {
@@ -89,266 +141,3200 @@ std::ostream& operator<<(std::ostream & os, const std::forward_list<T> & vlst) {
 
 } /* namespace cflc */
 
+//  MARK: - cflc::tail_list
 //  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc
+namespace cflc {
+
 /*
- *  MARK: C_forward_list()
+ *  MARK: tail_list
+ *  Singly linked list with the std::forward_list interface that also tracks
+ *  its last node.  Every mutator keeps tail_ current, so push_back,
+ *  emplace_back and splice_back are O(1) and the list doubles as a FIFO queue.
+ *  Unlike std::forward_list it also keeps its size, so size() is O(1).
  */
-auto C_forward_list(int argc, const char * argv[]) -> decltype(argc) {
-  std::cout << "In "s << __func__ << std::endl;
+template<typename T>
+class tail_list {
+  struct node_base {
+    node_base * next { nullptr };
+  };
+
+  struct node : node_base {
+    T value;
+
+    template<typename ... Args>
+    explicit node(Args && ... args) : value(std::forward<Args>(args) ...) {}
+  };
+
+public:
+  using value_type      = T;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference       = T &;
+  using const_reference = T const &;
+
+  template<bool Const>
+  class basic_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, T const *, T *>;
+    using reference         = std::conditional_t<Const, T const &, T &>;
+
+    basic_iterator() = default;
+    explicit basic_iterator(node_base * nb) : nb_(nb) {}
+
+    //  iterator -> const_iterator
+    template<bool C_ = Const, typename = std::enable_if_t<C_>>
+    basic_iterator(basic_iterator<false> const & other) : nb_(other.nb_) {}
+
+    reference operator*() const { return static_cast<node *>(nb_)->value; }
+    pointer operator->() const { return &static_cast<node *>(nb_)->value; }
+
+    basic_iterator & operator++() {
+      nb_ = nb_->next;
+      return *this;
+    }
 
-  /// Member functions
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::forward_list - constructor"s << '\n';
-  {
-    using namespace cflc;
+    basic_iterator operator++(int) {
+      auto tmp = *this;
+      nb_ = nb_->next;
+      return tmp;
+    }
 
-    // c++11 initializer list syntax:
-    std::forward_list<std::string> words1 {"the"s, "frogurt"s, "is"s, "also"s, "cursed"s};
-    std::cout << "words1: "s << words1 << '\n';
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) {
+      return lhs.nb_ == rhs.nb_;
+    }
 
-    // words2 == words1
-    std::forward_list<std::string> words2(words1.begin(), words1.end());
-    std::cout << "words2: "s << words2 << '\n';
+    friend bool operator!=(basic_iterator const & lhs, basic_iterator const & rhs) {
+      return lhs.nb_ != rhs.nb_;
+    }
 
-    // words3 == words1
-    std::forward_list<std::string> words3(words1);
-    std::cout << "words3: "s << words3 << '\n';
+  private:
+    friend class tail_list;
+    friend class basic_iterator<!Const>;
+    node_base * nb_ { nullptr };
+  };
 
-    // words4 is {"Mo", "Mo", "Mo", "Mo", "Mo"}
-    std::forward_list<std::string> words4(5, "Mo"s);
-    std::cout << "words4: "s << words4 << '\n';
+  using iterator       = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
 
-    std::cout << '\n';
+  tail_list() = default;
+
+  //  these delegate so that ~tail_list frees the nodes built so far if an
+  //  element constructor throws.
+  explicit tail_list(size_type count) : tail_list() { resize(count); }
+
+  tail_list(size_type count, T const & value) : tail_list() { resize(count, value); }
+
+  tail_list(std::initializer_list<T> init) : tail_list(init.begin(), init.end()) {}
+
+  template<std::input_iterator InputIt>
+  tail_list(InputIt first, InputIt last) : tail_list() {
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
   }
 
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - operator="s << '\n';
-  {
-    auto display_sizes = [](std::forward_list<int> const & nums1,
-                            std::forward_list<int> const & nums2,
-                            std::forward_list<int> const & nums3) {
-        std::cout << "nums1: "s << std::distance(nums1.begin(), nums1.end())
-                  << " nums2: "s << std::distance(nums2.begin(), nums2.end())
-                  << " nums3: "s << std::distance(nums3.begin(), nums3.end()) << '\n';
-    };
+  tail_list(tail_list const & other) : tail_list(other.begin(), other.end()) {}
 
-    std::forward_list<int> nums1 { 3, 1, 4, 6, 5, 9, };
-    std::forward_list<int> nums2;
-    std::forward_list<int> nums3;
+  tail_list(tail_list && other) noexcept {
+    steal(other);
+  }
 
-    std::cout << "Initially:\n";
-    display_sizes(nums1, nums2, nums3);
+  ~tail_list() { clear(); }
 
-    // copy assignment copies data from nums1 to nums2
-    nums2 = nums1;
+  tail_list & operator=(tail_list const & other) {
+    if (this != &other) {
+      tail_list tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
 
-    std::cout << "After assigment:\n";
-    display_sizes(nums1, nums2, nums3);
+  tail_list & operator=(tail_list && other) noexcept {
+    if (this != &other) {
+      clear();
+      steal(other);
+    }
+    return *this;
+  }
 
-    // move assignment moves data from nums1 to nums3,
-    // modifying both nums1 and nums3
-    nums3 = std::move(nums1);
+  tail_list & operator=(std::initializer_list<T> init) {
+    assign(init);
+    return *this;
+  }
 
-    std::cout << "After move assigment:\n";
-    display_sizes(nums1, nums2, nums3);
+  //  the assigns build aside and swap, so a throw leaves the list as it was.
+  void assign(size_type count, T const & value) {
+    tail_list tmp(count, value);
+    swap(tmp);
+  }
 
-    std::cout << '\n';
+  template<std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    tail_list tmp(first, last);
+    swap(tmp);
   }
 
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - assign"s << '\n';
-  {
-    std::forward_list<char> characters;
+  void assign(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
 
-    auto print_forward_list = [&](){
-      for (char chr : characters) {
-        std::cout << chr << ' ';
-      }
-      std::cout << '\n';
-    };
+  /// Element access
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return static_cast<node *>(tail_)->value; }
+  const_reference back() const { return static_cast<node const *>(tail_)->value; }
 
-    characters.assign(5, 'a');
-    print_forward_list();
+  /// Iterators
+  iterator before_begin() noexcept { return iterator(&head_); }
+  const_iterator before_begin() const noexcept { return cbefore_begin(); }
+  const_iterator cbefore_begin() const noexcept {
+    return const_iterator(const_cast<node_base *>(&head_));
+  }
+  iterator begin() noexcept { return iterator(head_.next); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept { return const_iterator(head_.next); }
+  iterator end() noexcept { return iterator(nullptr); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept { return const_iterator(nullptr); }
+
+  //  before_end() is the insertion point for appends: the last node, or
+  //  before_begin() when the list is empty.
+  iterator before_end() noexcept { return iterator(tail_); }
+  const_iterator before_end() const noexcept { return const_iterator(tail_); }
 
-    std::string const extra(6, 'b');
-    characters.assign(extra.begin(), extra.end());
-    print_forward_list();
+  /// Capacity
+  bool empty() const noexcept { return head_.next == nullptr; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<difference_type>::max() / sizeof(node);
+  }
 
-    characters.assign({ 'C', '+', '+', '1', '1', });
-    print_forward_list();
+  /// Modifiers
+  void clear() noexcept {
+    erase_after(before_begin(), end());
+  }
 
-    std::cout << '\n';
+  iterator insert_after(const_iterator pos, T const & value) {
+    return emplace_after(pos, value);
   }
 
-  /// Element access
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - front"s << '\n';
-  {
-    std::forward_list<char> letters { 'o', 'm', 'g', 'w', 't', 'f' };
+  iterator insert_after(const_iterator pos, T && value) {
+    return emplace_after(pos, std::move(value));
+  }
 
-    if (!letters.empty()) {
-      std::cout << "The first character is '"s << letters.front() << "'.\n"s;
+  iterator insert_after(const_iterator pos, size_type count, T const & value) {
+    for (; count != 0; --count) {
+      pos = emplace_after(pos, value);
     }
+    return iterator(pos.nb_);
+  }
 
-    std::cout << '\n';
+  template<std::input_iterator InputIt>
+  iterator insert_after(const_iterator pos, InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      pos = emplace_after(pos, *first);
+    }
+    return iterator(pos.nb_);
   }
 
-  /// Iterators
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - before_begin, cbefore_begin"s << '\n';
-  {
-    auto prlist = [](auto ln) {
-      std::cout << ln << '\n';
-    };
+  iterator insert_after(const_iterator pos, std::initializer_list<T> init) {
+    return insert_after(pos, init.begin(), init.end());
+  }
 
-    std::forward_list slist {
-      "O for a Muse of fire, that would ascend"s,
-      "The brightest heaven of invention,"s,
-      "A kingdom for a stage, princes to act"s,
-      "And monarchs to behold the swelling scene!"s,
-    };
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
-    std::cout << '\n';
+  template<typename ... Args>
+  iterator emplace_after(const_iterator pos, Args && ... args) {
+    auto nn = new node(std::forward<Args>(args) ...);
+    nn->next = pos.nb_->next;
+    pos.nb_->next = nn;
+    if (pos.nb_ == tail_) {
+      tail_ = nn;
+    }
+    ++size_;
+    return iterator(nn);
+  }
 
-    auto toinsert = std::vector {
-      "The Life of King Henry the Fifth."s,
-      "Act I."s,
-      "Prolog.\n"s
-    };
+  iterator erase_after(const_iterator pos) {
+    auto victim = pos.nb_->next;
+    pos.nb_->next = victim->next;
+    if (victim == tail_) {
+      tail_ = pos.nb_;
+    }
+    delete static_cast<node *>(victim);
+    --size_;
+    return iterator(pos.nb_->next);
+  }
 
-    auto it = slist.before_begin();
-    std::for_each(toinsert.crbegin(), toinsert.crend(), [&](auto ln) {
-      slist.insert_after(it, ln);
-    });
+  iterator erase_after(const_iterator pos, const_iterator last) {
+    auto nb = pos.nb_->next;
+    while (nb != last.nb_) {
+      auto victim = nb;
+      nb = nb->next;
+      delete static_cast<node *>(victim);
+      --size_;
+    }
+    pos.nb_->next = last.nb_;
+    if (last.nb_ == nullptr) {
+      tail_ = pos.nb_;
+    }
+    return iterator(last.nb_);
+  }
 
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
-    std::cout << '\n';
+  void push_front(T const & value) { emplace_after(cbefore_begin(), value); }
+  void push_front(T && value) { emplace_after(cbefore_begin(), std::move(value)); }
 
-    std::cout << '\n';
+  template<typename ... Args>
+  reference emplace_front(Args && ... args) {
+    return *emplace_after(cbefore_begin(), std::forward<Args>(args) ...);
   }
 
-  /// Iterators
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - begin, cbegin"s << '\n';
-  {
-    std::forward_list<int> nums { 1, 2, 4, 8, 16, };
-    std::forward_list<std::string> fruits {"orange"s, "apple"s, "raspberry"s};
-    std::forward_list<char> empty;
+  void pop_front() { erase_after(cbefore_begin()); }
 
-    // Print forward_list.
-    std::for_each(nums.begin(), nums.end(), [](const int nr) { std::cout << nr << ' '; });
-    std::cout << '\n';
+  void push_back(T const & value) { emplace_after(before_end(), value); }
+  void push_back(T && value) { emplace_after(before_end(), std::move(value)); }
 
-    // Sums all integers in the forward_list nums (if any), printing only the result.
-    std::cout << "Sum of nums: "s
-              << std::accumulate(nums.begin(), nums.end(), 0) << '\n';
+  template<typename ... Args>
+  reference emplace_back(Args && ... args) {
+    return *emplace_after(before_end(), std::forward<Args>(args) ...);
+  }
 
-    // Prints the first fruit in the forward_list fruits, checking if there is any.
-    if (!fruits.empty()) {
-      std::cout << "First fruit: "s << *fruits.begin() << '\n';
+  //  Shrinking cuts after the count-th node, which becomes the tail.
+  void resize(size_type count) {
+    if (count <= size_) {
+      erase_after(std::next(cbefore_begin(), count), cend());
+      return;
+    }
+    while (size_ < count) {
+      emplace_back();
     }
+  }
 
-    if (empty.begin() == empty.end()) {
-      std::cout << "forward_list 'empty' is indeed empty.\n"s;
+  void resize(size_type count, T const & value) {
+    if (count <= size_) {
+      erase_after(std::next(cbefore_begin(), count), cend());
+      return;
     }
+    insert_after(before_end(), count - size_, value);
+  }
 
-    std::cout << '\n';
+  /// Operations
+  //  Moves all of other's nodes in after pos.  O(1): other's tail is known.
+  void splice_after(const_iterator pos, tail_list & other) noexcept {
+    if (other.empty() || &other == this) {
+      return;
+    }
+    other.tail_->next = pos.nb_->next;
+    pos.nb_->next = other.head_.next;
+    if (pos.nb_ == tail_) {
+      tail_ = other.tail_;
+    }
+    size_ += other.size_;
+    other.reset();
   }
 
-  /// Capacity
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - empty"s << '\n';
-  {
-    std::forward_list<int> numbers;
-    std::cout << std::boolalpha;
-    std::cout << "Initially, numbers.empty(): "s << numbers.empty() << '\n';
+  void splice_after(const_iterator pos, tail_list && other) noexcept {
+    splice_after(pos, other);
+  }
 
-    numbers.push_front(42);
-    numbers.push_front(13'317);
-    std::cout << "After adding elements, numbers.empty(): "s << numbers.empty() << '\n';
-    std::cout << std::noboolalpha;
+  //  Moves the element after it to after pos.
+  void splice_after(const_iterator pos, tail_list & other, const_iterator it) noexcept {
+    auto const next = std::next(it);
+    if (pos == it || pos == next) {
+      return;
+    }
+    splice_after(pos, other, it, std::next(next));
+  }
 
-    std::cout << '\n';
+  void splice_after(const_iterator pos, tail_list && other, const_iterator it) noexcept {
+    splice_after(pos, other, it);
   }
 
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - max_size"s << '\n';
-  {
-    std::forward_list<char> s;
-    std::cout << "Maximum size of a 'forward_list' is "s << s.max_size() << "\n"s;
+  //  Moves the nodes in (first, last) to after pos, which must not be in the
+  //  range.  Walks the range once to find its last node, which is other's
+  //  tail when last is end() and becomes ours when pos is our tail.
+  void splice_after(const_iterator pos, tail_list & other,
+                    const_iterator first, const_iterator last) noexcept {
+    auto const head = first.nb_->next;
+    if (head == last.nb_ || pos == first) {
+      return;
+    }
+    auto tail = head;
+    size_type count { 1 };
+    while (tail->next != last.nb_) {
+      tail = tail->next;
+      ++count;
+    }
 
-    std::cout << '\n';
+    first.nb_->next = last.nb_;
+    if (other.tail_ == tail) {
+      other.tail_ = first.nb_;
+    }
+    other.size_ -= count;
+
+    tail->next = pos.nb_->next;
+    pos.nb_->next = head;
+    if (tail_ == pos.nb_) {
+      tail_ = tail;
+    }
+    size_ += count;
   }
 
-  /// Modifiers
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
-  std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - clear"s << '\n';
-  {
-    std::forward_list<int> container{ 1, 2, 3, };
+  void splice_after(const_iterator pos, tail_list && other,
+                    const_iterator first, const_iterator last) noexcept {
+    splice_after(pos, other, first, last);
+  }
 
-    auto print = [](int const & nr) { std::cout << " "s << nr; };
+  void splice_back(tail_list & other) noexcept { splice_after(before_end(), other); }
+  void splice_back(tail_list && other) noexcept { splice_after(before_end(), other); }
 
-    std::cout << "Before clear:"s;
-    std::for_each(container.begin(), container.end(), print);
-    std::cout << '\n';
+  //  Merges the sorted other into this sorted list by relinking; elements of
+  //  *this come first among equals.  Once *this runs out, the rest of other
+  //  is spliced on whole.
+  template<typename Compare = std::less<>>
+  void merge(tail_list & other, Compare comp = Compare()) {
+    if (&other == this) {
+      return;
+    }
+    auto prev = cbefore_begin();
+    while (!other.empty()) {
+      while (std::next(prev) != cend() && !comp(other.front(), *std::next(prev))) {
+        ++prev;
+      }
+      if (std::next(prev) == cend()) {
+        splice_after(prev, other);
+        break;
+      }
+      splice_after(prev, other, other.cbefore_begin());
+      ++prev;
+    }
+  }
 
-    std::cout << "Clear\n"s;
-    container.clear();
+  template<typename Compare = std::less<>>
+  void merge(tail_list && other, Compare comp = Compare()) {
+    merge(other, comp);
+  }
 
-    std::cout << "After clear:"s;
-    std::for_each(container.begin(), container.end(), print);
-    std::cout << '\n';
+  //  Removed nodes move to a local list destroyed on return, so a value that
+  //  refers into this list stays valid throughout.
+  template<typename Pred>
+  size_type remove_if(Pred pred) {
+    tail_list doomed;
+    auto prev = cbefore_begin();
+    while (std::next(prev) != cend()) {
+      if (pred(*std::next(prev))) {
+        doomed.splice_after(doomed.before_end(), *this, prev);
+      }
+      else {
+        ++prev;
+      }
+    }
+    return doomed.size();
+  }
 
-    std::cout << '\n';
+  size_type remove(T const & value) {
+    return remove_if([&value](T const & vx) { return vx == value; });
+  }
+
+  //  The first node becomes the tail.
+  void reverse() noexcept {
+    node_base * prev { nullptr };
+    auto nb = head_.next;
+    if (nb != nullptr) {
+      tail_ = nb;
+    }
+    while (nb != nullptr) {
+      auto next = nb->next;
+      nb->next = prev;
+      prev = nb;
+      nb = next;
+    }
+    head_.next = prev;
+  }
+
+  template<typename BinaryPred = std::equal_to<>>
+  size_type unique(BinaryPred pred = BinaryPred()) {
+    if (empty()) {
+      return 0;
+    }
+    tail_list doomed;
+    auto prev = cbegin();
+    while (std::next(prev) != cend()) {
+      if (pred(*prev, *std::next(prev))) {
+        doomed.splice_after(doomed.before_end(), *this, prev);
+      }
+      else {
+        ++prev;
+      }
+    }
+    return doomed.size();
+  }
+
+  //  Stable merge sort by relinking: the back half is split off by splice,
+  //  both halves are sorted and merged back.
+  template<typename Compare = std::less<>>
+  void sort(Compare comp = Compare()) {
+    if (size_ < 2) {
+      return;
+    }
+    tail_list back_half;
+    back_half.splice_after(back_half.cbefore_begin(), *this,
+                           std::next(cbefore_begin(), size_ / 2), cend());
+    sort(comp);
+    back_half.sort(comp);
+    merge(back_half, comp);
+  }
+
+  void swap(tail_list & other) noexcept {
+    std::swap(head_.next, other.head_.next);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    //  an empty list's tail is its own sentinel, which doesn't travel.
+    if (empty()) { tail_ = &head_; }
+    if (other.empty()) { other.tail_ = &other.head_; }
+  }
+
+private:
+  void reset() noexcept {
+    head_.next = nullptr;
+    tail_ = &head_;
+    size_ = 0;
+  }
+
+  void steal(tail_list & other) noexcept {
+    head_.next = other.head_.next;
+    tail_ = other.empty() ? &head_ : other.tail_;
+    size_ = other.size_;
+    other.reset();
   }
 
+  node_base head_;
+  node_base * tail_ { &head_ };
+  size_type size_ { 0 };
+};
+
+template<typename T>
+void swap(tail_list<T> & lhs, tail_list<T> & rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template<typename T>
+bool operator==(tail_list<T> const & lhs, tail_list<T> const & rhs) {
+  return lhs.size() == rhs.size()
+      && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T>
+auto operator<=>(tail_list<T> const & lhs, tail_list<T> const & rhs) {
+  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+                                                rhs.begin(), rhs.end());
+}
+
+template<typename T, typename U>
+auto erase(tail_list<T> & lst, U const & value) -> typename tail_list<T>::size_type {
+  return lst.remove_if([&value](T const & vx) { return vx == value; });
+}
+
+template<typename T, typename Pred>
+auto erase_if(tail_list<T> & lst, Pred pred) -> typename tail_list<T>::size_type {
+  return lst.remove_if(pred);
+}
+
+} /* namespace cflc */
+
+//  MARK: - cflc::work_queue, cflc::parallel_for_each
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc
+namespace cflc {
+
+/*
+ *  MARK: work_queue
+ *  Per-worker task list for a work-stealing scheduler.  The owner pushes and
+ *  pops at the front; a thief takes the back half of the victim's list with a
+ *  single splice_after, so stolen tasks are relinked, never copied.
+ */
+template<typename Task>
+class work_queue {
+public:
+  using size_type = std::size_t;
+
+  void push(Task task) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    tasks_.push_front(std::move(task));
+    ++size_;
+  }
+
+  //  Takes ownership of a whole prepared list; its order is preserved.
+  //  The tasks are counted before taking the lock.
+  void push(std::forward_list<Task> && tasks) {
+    auto const count = static_cast<size_type>(std::distance(tasks.begin(), tasks.end()));
+    std::lock_guard<std::mutex> lock(mtx_);
+    tasks_.splice_after(tasks_.before_begin(), tasks);
+    size_ += count;
+  }
+
+  auto pop() -> std::optional<Task> {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (tasks_.empty()) {
+      return std::nullopt;
+    }
+    std::optional<Task> task { std::move(tasks_.front()) };
+    tasks_.pop_front();
+    --size_;
+    return task;
+  }
+
+  //  Moves the back half of victim's tasks (rounded up) to the front of this
+  //  queue.  Returns the number of tasks stolen.
+  auto steal_from(work_queue & victim) -> size_type {
+    if (&victim == this) {
+      return 0;
+    }
+    std::scoped_lock lock(mtx_, victim.mtx_);
+    if (victim.size_ == 0) {
+      return 0;
+    }
+
+    auto const keep = victim.size_ / 2;
+    auto const take = victim.size_ - keep;
+    auto before = std::next(victim.tasks_.before_begin(), keep);
+    tasks_.splice_after(tasks_.before_begin(), victim.tasks_, before, victim.tasks_.end());
+    victim.size_ = keep;
+    size_ += take;
+
+    return take;
+  }
+
+  auto size() const -> size_type {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size_;
+  }
+
+  auto empty() const -> bool { return size() == 0; }
+
+private:
+  mutable std::mutex mtx_;
+  std::forward_list<Task> tasks_;
+  size_type size_ { 0 };
+};
+
+/*
+ *  MARK: parallel_for_each
+ *  Applies fn to every element of [first, last) on nthreads workers.
+ *  One pass cuts the range into chunks of grain elements (iterator pairs into
+ *  the original list, the elements themselves are not copied); each worker is
+ *  dealt a contiguous block of chunks and steals from the others when idle.
+ *  The first exception thrown by fn is rethrown after all workers join.
+ */
+template<typename ForwardIt, typename Fn>
+void parallel_for_each(ForwardIt first, ForwardIt last, Fn fn,
+                       std::size_t nthreads = std::thread::hardware_concurrency(),
+                       std::size_t grain = 1'024) {
+  using chunk = std::pair<ForwardIt, ForwardIt>;
+
+  nthreads = std::max<std::size_t>(nthreads, 1);
+  grain    = std::max<std::size_t>(grain, 1);
+
+  std::forward_list<chunk> chunks;
+  auto ctail = chunks.before_begin();
+  std::size_t nchunks { 0 };
+  while (first != last) {
+    auto cfirst = first;
+    for (std::size_t ix { 0 }; ix < grain && first != last; ++ix) {
+      ++first;
+    }
+    ctail = chunks.emplace_after(ctail, cfirst, first);
+    ++nchunks;
+  }
+
+  if (nchunks == 0) {
+    return;
+  }
+  nthreads = std::min(nthreads, nchunks);
+  if (nthreads == 1) {
+    for (auto & [cfirst, clast] : chunks) {
+      std::for_each(cfirst, clast, fn);
+    }
+    return;
+  }
+
+  //  deal contiguous blocks so neighbouring nodes stay with one worker.
+  std::vector<work_queue<chunk>> queues(nthreads);
+  for (std::size_t wx { 0 }; wx < nthreads; ++wx) {
+    auto const count = nchunks / nthreads + (wx < nchunks % nthreads ? 1 : 0);
+    std::forward_list<chunk> block;
+    block.splice_after(block.before_begin(), chunks, chunks.before_begin(),
+                       std::next(chunks.begin(), count));
+    queues[wx].push(std::move(block));
+  }
+
+  std::mutex emtx;
+  std::exception_ptr eptr;
+  std::atomic<bool> failed { false };
+
+  auto worker = [&](std::size_t self) {
+    try {
+      for (;;) {
+        if (failed.load(std::memory_order_relaxed)) {
+          return;
+        }
+        if (auto task = queues[self].pop()) {
+          std::for_each(task->first, task->second, fn);
+          continue;
+        }
+
+        //  no new tasks are ever produced, so a full pass over the
+        //  victims without a successful steal means we are done.
+        bool stolen { false };
+        for (std::size_t vx { 1 }; vx < nthreads && !stolen; ++vx) {
+          stolen = queues[self].steal_from(queues[(self + vx) % nthreads]) != 0;
+        }
+        if (!stolen) {
+          return;
+        }
+      }
+    }
+    catch (...) {
+      std::lock_guard<std::mutex> lock(emtx);
+      if (!eptr) {
+        eptr = std::current_exception();
+      }
+      failed = true;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nthreads - 1);
+  for (std::size_t wx { 1 }; wx < nthreads; ++wx) {
+    threads.emplace_back(worker, wx);
+  }
+  worker(0);
+  for (auto & thr : threads) {
+    thr.join();
+  }
+
+  if (eptr) {
+    std::rethrow_exception(eptr);
+  }
+}
+
+template<typename T, typename Fn>
+void parallel_for_each(std::forward_list<T> & lst, Fn fn,
+                       std::size_t nthreads = std::thread::hardware_concurrency(),
+                       std::size_t grain = 1'024) {
+  parallel_for_each(lst.begin(), lst.end(), std::move(fn), nthreads, grain);
+}
+
+template<typename T, typename Fn>
+void parallel_for_each(std::forward_list<T> const & lst, Fn fn,
+                       std::size_t nthreads = std::thread::hardware_concurrency(),
+                       std::size_t grain = 1'024) {
+  parallel_for_each(lst.cbegin(), lst.cend(), std::move(fn), nthreads, grain);
+}
+
+} /* namespace cflc */
+
+//  MARK: - cflc::parallel_remove_if, cflc::parallel_erase_if
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc
+namespace cflc {
+
+namespace detail {
+
+/*
+ *  MARK: split_apply_stitch
+ *  Splits lst into at most nthreads segments of at least min_segment nodes,
+ *  runs unlink(segment) -> {erased, before_end} on each segment concurrently
+ *  and splices the survivors back together in their original order.
+ *  The split is one walk to find boundaries; detaching and stitching are
+ *  splices (relinks only, no element is copied or moved).
+ */
+template<typename T, typename Unlink>
+auto split_apply_stitch(std::forward_list<T> & lst, Unlink unlink,
+                        std::size_t nthreads, std::size_t min_segment) -> std::size_t {
+  using list_type = std::forward_list<T>;
+  using before_end_type = typename list_type::iterator;
+
+  nthreads    = std::max<std::size_t>(nthreads, 1);
+  min_segment = std::max<std::size_t>(min_segment, 1);
+
+  //  one pass: remember the node before every min_segment'th element.
+  std::vector<before_end_type> marks;
+  std::size_t count { 0 };
+  for (auto it = lst.before_begin(); std::next(it) != lst.end(); ++it, ++count) {
+    if (count % min_segment == 0) {
+      marks.push_back(it);
+    }
+  }
+
+  auto const nseg = std::min(nthreads, marks.size());
+  if (nseg <= 1) {
+    return unlink(lst).first;
+  }
+
+  //  detach from the back so each splice only walks its own segment;
+  //  the first segment stays in lst.
+  std::vector<list_type> segs(nseg);
+  for (std::size_t sx { nseg - 1 }; sx > 0; --sx) {
+    auto before = marks[sx * marks.size() / nseg];
+    segs[sx].splice_after(segs[sx].before_begin(), lst, before, lst.end());
+  }
+  auto segment = [&](std::size_t sx) -> list_type & {
+    return sx == 0 ? lst : segs[sx];
+  };
+
+  std::vector<std::size_t> erased(nseg);
+  std::vector<before_end_type> tails(nseg);
+  std::vector<std::exception_ptr> errors(nseg);
+
+  auto worker = [&](std::size_t sx) {
+    try {
+      std::tie(erased[sx], tails[sx]) = unlink(segment(sx));
+    }
+    catch (...) {
+      errors[sx] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nseg - 1);
+  for (std::size_t sx { 1 }; sx < nseg; ++sx) {
+    threads.emplace_back(worker, sx);
+  }
+  worker(0);
+  for (auto & thr : threads) {
+    thr.join();
+  }
+
+  //  stitch back; a segment whose predicate threw is kept as far as it got.
+  auto before_end = [&](std::size_t sx) {
+    auto & seg = segment(sx);
+    return errors[sx] ? std::next(seg.before_begin(), std::distance(seg.begin(), seg.end()))
+                      : tails[sx];
+  };
+  auto tail = before_end(0);
+  for (std::size_t sx { 1 }; sx < nseg; ++sx) {
+    if (segs[sx].empty()) {
+      continue;
+    }
+    auto seg_tail = before_end(sx);
+    lst.splice_after(tail, segs[sx]);
+    tail = seg_tail;
+  }
+
+  for (auto & eptr : errors) {
+    if (eptr) {
+      std::rethrow_exception(eptr);
+    }
+  }
+
+  return std::accumulate(erased.begin(), erased.end(), std::size_t { 0 });
+}
+
+} /* namespace detail */
+
+/*
+ *  MARK: parallel_remove_if
+ *  Parallel lst.remove_if(pred): the predicate is evaluated concurrently on
+ *  up to nthreads segments of the list.  pred must be safe to call from
+ *  several threads.  Returns the number of elements erased.
+ */
+template<typename T, typename Pred>
+auto parallel_remove_if(std::forward_list<T> & lst, Pred pred,
+                        std::size_t nthreads = std::thread::hardware_concurrency(),
+                        std::size_t min_segment = 4'096) -> std::size_t {
+  auto unlink = [&pred](std::forward_list<T> & seg) {
+    std::size_t erased { 0 };
+    auto prev = seg.before_begin();
+    for (auto it = seg.begin(); it != seg.end(); ) {
+      if (pred(*it)) {
+        it = seg.erase_after(prev);
+        ++erased;
+      }
+      else {
+        prev = it++;
+      }
+    }
+    return std::make_pair(erased, prev);
+  };
+
+  return detail::split_apply_stitch(lst, unlink, nthreads, min_segment);
+}
+
+/*
+ *  MARK: parallel_remove_if_batched
+ *  As parallel_remove_if, but pred is called on batches of consecutive values
+ *  gathered into a contiguous buffer:
+ *    pred(std::span<T const> values, std::span<unsigned char> remove)
+ *  sets remove[i] non-zero for each value to erase.  With a contiguous batch
+ *  the predicate can be written as a vectorizable loop.  Only for trivially
+ *  copyable T, where the gather is a cheap copy.
+ */
+template<typename T, typename BatchPred>
+auto parallel_remove_if_batched(std::forward_list<T> & lst, BatchPred pred,
+                                std::size_t nthreads = std::thread::hardware_concurrency(),
+                                std::size_t batch = 256,
+                                std::size_t min_segment = 4'096) -> std::size_t {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "parallel_remove_if_batched gathers values; T must be trivially copyable");
+
+  batch = std::max<std::size_t>(batch, 1);
+
+  auto unlink = [&pred, batch](std::forward_list<T> & seg) {
+    std::vector<T> values;
+    std::vector<unsigned char> remove(batch);
+    values.reserve(batch);
+
+    std::size_t erased { 0 };
+    auto prev = seg.before_begin();
+    while (std::next(prev) != seg.end()) {
+      values.clear();
+      for (auto it = std::next(prev); it != seg.end() && values.size() < batch; ++it) {
+        values.push_back(*it);
+      }
+      std::fill(remove.begin(), remove.end(), 0);
+      pred(std::span<T const>(values), std::span<unsigned char>(remove.data(), values.size()));
+
+      for (std::size_t ix { 0 }; ix < values.size(); ++ix) {
+        if (remove[ix]) {
+          seg.erase_after(prev);
+          ++erased;
+        }
+        else {
+          ++prev;
+        }
+      }
+    }
+    return std::make_pair(erased, prev);
+  };
+
+  return detail::split_apply_stitch(lst, unlink, nthreads, min_segment);
+}
+
+/*
+ *  MARK: parallel_erase_if
+ *  Parallel std::erase_if(lst, pred).  Returns the number of elements erased.
+ */
+template<typename T, typename Pred>
+auto parallel_erase_if(std::forward_list<T> & lst, Pred pred,
+                       std::size_t nthreads = std::thread::hardware_concurrency(),
+                       std::size_t min_segment = 4'096) -> std::size_t {
+  return parallel_remove_if(lst, std::move(pred), nthreads, min_segment);
+}
+
+} /* namespace cflc */
+
+//  MARK: - cflc::indexed_list
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc
+namespace cflc {
+
+/*
+ *  MARK: indexed_list
+ *  std::forward_list with an indexable skip list on the side.  The list
+ *  itself is level 0; on average one element in every `stride` carries a
+ *  tower of express links, each link recording how many positions it skips.
+ *  That gives O(log n) expected nth(i), lower_bound (on a sorted list) and
+ *  positional insert/erase/splice, and the towers are maintained
+ *  incrementally by every mutator.
+ *  Positions: the before_begin node is position 0, element i is position i + 1.
+ */
+template<typename T, typename Compare = std::less<T>>
+class indexed_list {
+public:
+  using list_type       = std::forward_list<T>;
+  using value_type      = T;
+  using size_type       = std::size_t;
+  using iterator        = typename list_type::iterator;
+  using const_iterator  = typename list_type::const_iterator;
+
+  static constexpr size_type max_level = 16;
+
+  explicit indexed_list(size_type stride = 8, Compare comp = Compare())
+    : comp_(std::move(comp)), stride_(std::max<size_type>(stride, 2)) {
+    reset_head();
+  }
+
+  indexed_list(std::initializer_list<T> init, size_type stride = 8, Compare comp = Compare())
+    : indexed_list(init.begin(), init.end(), stride, std::move(comp)) {}
+
+  template<typename InputIt>
+  indexed_list(InputIt first, InputIt last, size_type stride = 8, Compare comp = Compare())
+    : list_(first, last), comp_(std::move(comp)), stride_(std::max<size_type>(stride, 2)) {
+    size_ = std::distance(list_.begin(), list_.end());
+    rebuild();
+  }
+
+  indexed_list(indexed_list const & other)
+    : list_(other.list_), comp_(other.comp_), stride_(other.stride_),
+      size_(other.size_), rng_(other.rng_) {
+    rebuild();
+  }
+
+  //  towers hold iterators to list nodes, which survive the move; the head
+  //  tower stands for before_begin() and never stores an iterator.
+  indexed_list(indexed_list && other) noexcept
+    : list_(std::move(other.list_)), comp_(std::move(other.comp_)), stride_(other.stride_),
+      head_(std::move(other.head_)), size_(other.size_), rng_(other.rng_) {
+    other.list_.clear();
+    other.size_ = 0;
+    other.reset_head();
+  }
+
+  ~indexed_list() { drop_towers(); }
+
+  indexed_list & operator=(indexed_list other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  void swap(indexed_list & other) noexcept {
+    std::swap(list_, other.list_);
+    std::swap(comp_, other.comp_);
+    std::swap(stride_, other.stride_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(rng_, other.rng_);
+  }
+
+  /// Access
+  auto list() const noexcept -> list_type const & { return list_; }
+  auto size() const noexcept -> size_type { return size_; }
+  auto empty() const noexcept -> bool { return size_ == 0; }
+
+  auto begin() noexcept -> iterator { return list_.begin(); }
+  auto end() noexcept -> iterator { return list_.end(); }
+  auto begin() const noexcept -> const_iterator { return list_.begin(); }
+  auto end() const noexcept -> const_iterator { return list_.end(); }
+
+  //  Iterator to element ix; O(log n) expected instead of std::next(begin(), ix).
+  auto nth(size_type ix) -> iterator {
+    return locate(ix + 1);
+  }
+
+  auto nth(size_type ix) const -> const_iterator {
+    return const_cast<indexed_list &>(*this).locate(ix + 1);
+  }
+
+  //  First element not less than value, and its index; the list must be
+  //  sorted by Compare.  Returns { size(), end() } if there is none.
+  auto lower_bound(T const & value) const -> std::pair<size_type, const_iterator> {
+    auto [pos, before] = const_cast<indexed_list &>(*this).find_before(value);
+    return { pos, std::next(const_iterator(before)) };
+  }
+
+  /// Modifiers
+  //  Inserts value so that it becomes element ix (0 <= ix <= size()).
+  auto insert(size_type ix, T const & value) -> iterator {
+    return emplace(ix, value);
+  }
+
+  template<typename ... Args>
+  auto emplace(size_type ix, Args && ... args) -> iterator {
+    update_type update;
+    auto before = locate(ix, &update);
+    auto it = list_.emplace_after(before, std::forward<Args>(args) ...);
+    ++size_;
+    link_run(update, it, ix + 1, 1);
+    return it;
+  }
+
+  void push_front(T const & value) { emplace(0, value); }
+
+  //  Inserts value before the first element not less than it.
+  auto insert_sorted(T const & value) -> iterator {
+    return insert(lower_bound(value).first, value);
+  }
+
+  //  Removes count elements starting at element ix: the positional form of
+  //  erase_after(nth(ix - 1), nth(ix + count)).
+  void erase(size_type ix, size_type count = 1) {
+    if (ix >= size_ || count == 0) {
+      return;
+    }
+    count = std::min(count, size_ - ix);
+
+    update_type update;
+    auto before = locate(ix, &update);
+    auto const last_pos = ix + count;
+
+    std::vector<tower *> victims;
+    for (auto lx = max_level; lx-- > 0; ) {
+      auto & link = update.towers[lx]->links[lx];
+      auto dist = link.width;
+      auto nxt = link.next;
+      while (nxt != nullptr && update.pos[lx] + dist <= last_pos) {
+        dist += nxt->links[lx].width;
+        if (lx == 0) {
+          victims.push_back(nxt);
+        }
+        nxt = nxt->links[lx].next;
+      }
+      link.next = nxt;
+      link.width = dist - count;
+    }
+    for (auto victim : victims) {
+      delete victim;
+    }
+
+    list_.erase_after(before, std::next(before, count + 1));
+    size_ -= count;
+  }
+
+  //  Moves all of other's elements in so that its first becomes element ix.
+  void splice(size_type ix, list_type & other) {
+    auto const count = static_cast<size_type>(std::distance(other.begin(), other.end()));
+    if (count == 0) {
+      return;
+    }
+
+    update_type update;
+    auto before = locate(ix, &update);
+    list_.splice_after(before, other);
+    size_ += count;
+    link_run(update, std::next(before), ix + 1, count);
+  }
+
+  void splice(size_type ix, list_type && other) { splice(ix, other); }
+
+  void clear() noexcept {
+    drop_towers();
+    list_.clear();
+    size_ = 0;
+    reset_head();
+  }
+
+  void sort() {
+    list_.sort(comp_);
+    rebuild();
+  }
+
+  //  Rebuilds every tower in one pass; used after bulk changes to list order.
+  void rebuild() {
+    drop_towers();
+    reset_head();
+    update_type update;
+    update.towers.fill(&head_);
+    update.pos.fill(0);
+    link_run(update, list_.begin(), 1, size_);
+  }
+
+private:
+  struct tower {
+    struct link {
+      tower * next { nullptr };
+      size_type width { 0 };
+    };
+
+    iterator it;
+    std::vector<link> links;
+  };
+
+  struct update_type {
+    std::array<tower *, max_level> towers;
+    std::array<size_type, max_level> pos;
+  };
+
+  auto height() -> size_type {
+    size_type level { 0 };
+    while (level < max_level && rng_() % stride_ == 0) {
+      ++level;
+    }
+    return level;
+  }
+
+  auto iterator_of(tower * twr) -> iterator {
+    return twr == &head_ ? list_.before_begin() : twr->it;
+  }
+
+  //  Iterator at position pos; records the last tower at or before pos on
+  //  every level when update is given.
+  auto locate(size_type pos, update_type * update = nullptr) -> iterator {
+    tower * cur = &head_;
+    size_type cur_pos { 0 };
+    for (auto lx = max_level; lx-- > 0; ) {
+      while (cur->links[lx].next != nullptr && cur_pos + cur->links[lx].width <= pos) {
+        cur_pos += cur->links[lx].width;
+        cur = cur->links[lx].next;
+      }
+      if (update != nullptr) {
+        update->towers[lx] = cur;
+        update->pos[lx] = cur_pos;
+      }
+    }
+    return std::next(iterator_of(cur), pos - cur_pos);
+  }
+
+  //  Position of, and iterator to, the last node whose value is less than value.
+  auto find_before(T const & value) -> std::pair<size_type, iterator> {
+    tower * cur = &head_;
+    size_type cur_pos { 0 };
+    for (auto lx = max_level; lx-- > 0; ) {
+      while (cur->links[lx].next != nullptr && comp_(*cur->links[lx].next->it, value)) {
+        cur_pos += cur->links[lx].width;
+        cur = cur->links[lx].next;
+      }
+    }
+    auto it = iterator_of(cur);
+    for (auto nxt = std::next(it); nxt != list_.end() && comp_(*nxt, value); ++nxt) {
+      it = nxt;
+      ++cur_pos;
+    }
+    return { cur_pos, it };
+  }
+
+  //  Links towers for count new nodes starting at first (position first_pos),
+  //  just after the towers recorded in update, whose links are first widened
+  //  over the inserted run.
+  void link_run(update_type & update, iterator first, size_type first_pos, size_type count) {
+    for (size_type lx { 0 }; lx < max_level; ++lx) {
+      update.towers[lx]->links[lx].width += count;
+    }
+
+    auto pos = first_pos;
+    for (size_type ix { 0 }; ix < count; ++ix, ++first, ++pos) {
+      auto const levels = height();
+      if (levels == 0) {
+        continue;
+      }
+      auto twr = new tower { first, std::vector<typename tower::link>(levels) };
+      for (size_type lx { 0 }; lx < levels; ++lx) {
+        auto & link = update.towers[lx]->links[lx];
+        twr->links[lx].next = link.next;
+        twr->links[lx].width = update.pos[lx] + link.width - pos;
+        link.next = twr;
+        link.width = pos - update.pos[lx];
+        update.towers[lx] = twr;
+        update.pos[lx] = pos;
+      }
+    }
+  }
+
+  void reset_head() {
+    head_.links.assign(max_level, typename tower::link { nullptr, 1 });
+  }
+
+  void drop_towers() noexcept {
+    if (head_.links.empty()) {
+      return;
+    }
+    for (auto twr = head_.links[0].next; twr != nullptr; ) {
+      auto victim = twr;
+      twr = twr->links[0].next;
+      delete victim;
+    }
+    for (auto & link : head_.links) {
+      link.next = nullptr;
+    }
+  }
+
+  list_type list_;
+  Compare comp_;
+  size_type stride_;
+  tower head_;
+  size_type size_ { 0 };
+  std::minstd_rand rng_ { 5'489u };
+};
+
+template<typename T, typename Compare>
+std::ostream& operator<<(std::ostream & os, const indexed_list<T, Compare> & vlst) {
+  return os << vlst.list();
+}
+
+} /* namespace cflc */
+
+//  MARK: - cflc::external_sorter
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc
+namespace cflc {
+
+/*
+ *  MARK: io_pool
+ *  Fixed pool of threads for background file I/O; jobs queue in a tail_list.
+ *  The destructor runs every queued job before joining.
+ */
+class io_pool {
+public:
+  explicit io_pool(std::size_t nthreads = 2) {
+    nthreads = std::max<std::size_t>(nthreads, 1);
+    for (std::size_t tx { 0 }; tx < nthreads; ++tx) {
+      threads_.emplace_back([this] { run(); });
+    }
+  }
+
+  io_pool(io_pool const &) = delete;
+  io_pool & operator=(io_pool const &) = delete;
+
+  ~io_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto & thr : threads_) {
+      thr.join();
+    }
+  }
+
+  template<typename Fn>
+  auto submit(Fn fn) -> std::future<void> {
+    std::packaged_task<void()> job(std::move(fn));
+    auto done = job.get_future();
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      jobs_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+    return done;
+  }
+
+private:
+  void run() {
+    for (;;) {
+      std::packaged_task<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+        if (jobs_.empty()) {
+          return;
+        }
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      job();
+    }
+  }
+
+  std::mutex mtx_;
+  std::condition_variable cv_;
+  tail_list<std::packaged_task<void()>> jobs_;
+  bool stop_ { false };
+  std::vector<std::thread> threads_;
+};
+
+/*
+ *  MARK: external_sorter
+ *  sort() + merge() for forward-list-shaped data that does not fit in memory.
+ *  Elements are collected into a contiguous block of a third of the memory
+ *  budget; a full block is stable_sorted (scratch of up to one more block)
+ *  and written to an anonymous temp file as raw T records on an io_pool
+ *  thread while the next block fills.  At most max_fan_in runs are merged
+ *  at once: a level that fills up is merged into one run on the next level,
+ *  which bounds both the open files and the readers of the final merge.
+ *  Each reader prefetches its next block through the same pool; during a
+ *  merge of k runs the budget is shared by two blocks per run and one
+ *  output block.
+ *  T must be trivially copyable.  merge() consumes the sorter; the merge is
+ *  stable.
+ */
+template<typename T, typename Compare = std::less<T>>
+class external_sorter {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "external_sorter spills raw records; T must be trivially copyable");
+
+public:
+  using value_type = T;
+  using size_type  = std::size_t;
+
+  //  smallest merge block worth a read; caps the fan-in for small budgets.
+  static constexpr size_type min_block_bytes = 64 * 1'024;
+
+  explicit external_sorter(size_type memory_budget = 64 * 1'024 * 1'024, Compare comp = Compare(),
+                           size_type max_fan_in = 64, size_type io_threads = 2)
+    : comp_(std::move(comp)), budget_(std::max<size_type>(memory_budget, 4 * sizeof(T))),
+      block_capacity_(std::max<size_type>(budget_ / 3 / sizeof(T), 1)),
+      fan_in_(std::max<size_type>(std::min(max_fan_in, budget_ / (2 * min_block_bytes)), 2)),
+      pool_(io_threads) {}
+
+  external_sorter(external_sorter const &) = delete;
+  external_sorter & operator=(external_sorter const &) = delete;
+
+  ~external_sorter() {
+    if (pending_.valid()) {
+      pending_.wait();
+    }
+  }
+
+  void push(T const & value) {
+    if (fill_.capacity() < block_capacity_) {
+      fill_.reserve(block_capacity_);
+    }
+    fill_.push_back(value);
+    ++size_;
+    if (fill_.size() == block_capacity_) {
+      spill();
+    }
+  }
+
+  template<typename InputIt>
+  void push(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      push(*first);
+    }
+  }
+
+  //  Consumes lst, freeing each node as its value is taken.
+  void push(std::forward_list<T> && lst) {
+    while (!lst.empty()) {
+      push(lst.front());
+      lst.pop_front();
+    }
+  }
+
+  auto size() const noexcept -> size_type { return size_; }
+  auto fan_in() const noexcept -> size_type { return fan_in_; }
+
+  //  Sorted blocks written to disk so far.  Full levels are merged as they
+  //  fill, so runs() can be far fewer.
+  auto spills() const noexcept -> size_type { return spills_; }
+
+  //  Runs currently on disk, across all merge levels.
+  auto runs() const noexcept -> size_type {
+    return std::accumulate(levels_.begin(), levels_.end(), size_type { 0 },
+                           [](size_type acc, auto const & level) { return acc + level.size(); });
+  }
+
+  //  Calls sink(value) for every element in sorted order.
+  template<typename Sink>
+  void merge(Sink sink) {
+    if (runs() == 0) {
+      //  everything fit in the budget: no I/O at all.
+      std::stable_sort(fill_.begin(), fill_.end(), comp_);
+      for (auto const & value : fill_) {
+        sink(value);
+      }
+      release_blocks();
+      size_ = 0;
+      return;
+    }
+
+    if (!fill_.empty()) {
+      spill();
+    }
+    wait_pending();
+    release_blocks();
+
+    //  oldest runs first (the highest level), so equal keys keep their order.
+    std::vector<run_file> all;
+    for (auto level = levels_.rbegin(); level != levels_.rend(); ++level) {
+      std::move(level->begin(), level->end(), std::back_inserter(all));
+    }
+    levels_.clear();
+
+    while (all.size() > fan_in_) {
+      std::vector<run_file> next;
+      for (size_type first { 0 }; first < all.size(); first += fan_in_) {
+        auto last = std::min(first + fan_in_, all.size());
+        std::vector<run_file> group(std::make_move_iterator(all.begin() + first),
+                                    std::make_move_iterator(all.begin() + last));
+        next.push_back(merge_to_run(group));
+      }
+      all = std::move(next);
+    }
+
+    merge_runs(all, sink);
+    size_ = 0;
+  }
+
+  auto merge_to_list() -> std::forward_list<T> {
+    std::forward_list<T> out;
+    auto tail = out.before_begin();
+    merge([&](T const & value) { tail = out.insert_after(tail, value); });
+    return out;
+  }
+
+  //  Writes the sorted elements to os as raw T records.
+  void merge_to(std::ostream & os) {
+    merge([&](T const & value) {
+      os.write(reinterpret_cast<char const *>(&value), sizeof(T));
+    });
+  }
+
+private:
+  struct file_closer {
+    void operator()(std::FILE * fp) const noexcept { std::fclose(fp); }
+  };
+  using file_ptr = std::unique_ptr<std::FILE, file_closer>;
+
+  struct run_file {
+    file_ptr fp;
+    size_type count;
+  };
+
+  static auto make_temp() -> file_ptr {
+    file_ptr fp(std::tmpfile());
+    if (!fp) {
+      throw std::runtime_error("external_sorter: cannot create temp file");
+    }
+    return fp;
+  }
+
+  static void write_block(std::FILE * fp, std::vector<T> const & block) {
+    if (std::fwrite(block.data(), sizeof(T), block.size(), fp) != block.size()) {
+      throw std::runtime_error("external_sorter: short write to run file");
+    }
+  }
+
+  static void read_block(std::FILE * fp, std::vector<T> & block) {
+    if (std::fread(block.data(), sizeof(T), block.size(), fp) != block.size()) {
+      throw std::runtime_error("external_sorter: short read from run file");
+    }
+  }
+
+  //  Double-buffered reader: the next block is read on the pool while the
+  //  current one is merged.  Not movable; readers live in a forward_list.
+  class run_reader {
+  public:
+    run_reader(run_file & run, size_type block, size_type order, io_pool & pool)
+      : fp_(run.fp.get()), left_(run.count), block_(block), order_(order), pool_(pool) {
+      std::rewind(fp_);
+      current_.resize(std::min(left_, block_));
+      read_block(fp_, current_);
+      left_ -= current_.size();
+      prefetch();
+    }
+
+    run_reader(run_reader const &) = delete;
+    run_reader & operator=(run_reader const &) = delete;
+
+    ~run_reader() {
+      if (next_ready_.valid()) {
+        next_ready_.wait();
+      }
+    }
+
+    auto done() const -> bool { return ix_ == current_.size(); }
+    auto value() const -> T const & { return current_[ix_]; }
+    auto order() const -> size_type { return order_; }
+
+    auto advance() -> bool {
+      if (++ix_ == current_.size() && next_ready_.valid()) {
+        next_ready_.get();
+        std::swap(current_, next_);
+        ix_ = 0;
+        prefetch();
+      }
+      return !done();
+    }
+
+  private:
+    void prefetch() {
+      if (left_ != 0) {
+        next_.resize(std::min(left_, block_));
+        left_ -= next_.size();
+        next_ready_ = pool_.submit([fp = fp_, buf = &next_] { read_block(fp, *buf); });
+      }
+    }
+
+    std::FILE * fp_;
+    size_type left_;
+    size_type block_;
+    size_type order_;
+    io_pool & pool_;
+    std::vector<T> current_;
+    std::vector<T> next_;
+    size_type ix_ { 0 };
+    std::future<void> next_ready_;
+  };
+
+  auto merge_block(size_type nruns) const -> size_type {
+    return std::max<size_type>(budget_ / ((2 * nruns + 1) * sizeof(T)), 1);
+  }
+
+  //  k-way merge of runs (oldest first) into sink; ties go to the older run.
+  template<typename Sink>
+  void merge_runs(std::vector<run_file> & runs, Sink & sink) {
+    auto const block = merge_block(runs.size());
+    std::forward_list<run_reader> readers;
+    auto rtail = readers.before_begin();
+    for (size_type rx { 0 }; rx < runs.size(); ++rx) {
+      rtail = readers.emplace_after(rtail, runs[rx], block, rx, pool_);
+    }
+
+    auto greater = [this](run_reader const * lhs, run_reader const * rhs) {
+      return comp_(rhs->value(), lhs->value())
+          || (!comp_(lhs->value(), rhs->value()) && lhs->order() > rhs->order());
+    };
+    std::priority_queue<run_reader *, std::vector<run_reader *>, decltype(greater)> heap(greater);
+    for (auto & reader : readers) {
+      if (!reader.done()) {
+        heap.push(&reader);
+      }
+    }
+
+    while (!heap.empty()) {
+      auto reader = heap.top();
+      heap.pop();
+      sink(reader->value());
+      if (reader->advance()) {
+        heap.push(reader);
+      }
+    }
+
+    readers.clear();
+    runs.clear();
+  }
+
+  auto merge_to_run(std::vector<run_file> & runs) -> run_file {
+    auto fp = make_temp();
+    auto raw = fp.get();
+    std::vector<T> out;
+    out.reserve(merge_block(runs.size()));
+    size_type count { 0 };
+
+    auto sink = [&](T const & value) {
+      out.push_back(value);
+      ++count;
+      if (out.size() == out.capacity()) {
+        write_block(raw, out);
+        out.clear();
+      }
+    };
+    merge_runs(runs, sink);
+    write_block(raw, out);
+    if (std::fflush(raw) != 0) {
+      throw std::runtime_error("external_sorter: short write to run file");
+    }
+
+    return run_file { std::move(fp), count };
+  }
+
+  void spill() {
+    std::stable_sort(fill_.begin(), fill_.end(), comp_);
+
+    //  at most one write in flight; its block is then free to fill again.
+    wait_pending();
+    std::swap(fill_, writing_);
+    fill_.clear();
+
+    auto fp = make_temp();
+    auto raw = fp.get();
+    pending_ = pool_.submit([raw, block = &writing_] {
+      write_block(raw, *block);
+      if (std::fflush(raw) != 0) {
+        throw std::runtime_error("external_sorter: short write to run file");
+      }
+    });
+
+    if (levels_.empty()) {
+      levels_.emplace_back();
+    }
+    levels_[0].push_back(run_file { std::move(fp), writing_.size() });
+    ++spills_;
+
+    if (levels_[0].size() == fan_in_) {
+      //  the merge borrows the whole budget from the idle blocks.
+      wait_pending();
+      release_blocks();
+      for (size_type lx { 0 }; lx < levels_.size() && levels_[lx].size() == fan_in_; ++lx) {
+        auto merged = merge_to_run(levels_[lx]);
+        if (lx + 1 == levels_.size()) {
+          levels_.emplace_back();
+        }
+        levels_[lx + 1].push_back(std::move(merged));
+      }
+    }
+  }
+
+  void wait_pending() {
+    if (pending_.valid()) {
+      pending_.get();
+    }
+  }
+
+  void release_blocks() {
+    std::vector<T>().swap(fill_);
+    std::vector<T>().swap(writing_);
+  }
+
+  Compare comp_;
+  size_type budget_;
+  size_type block_capacity_;
+  size_type fan_in_;
+  size_type size_ { 0 };
+  size_type spills_ { 0 };
+  std::vector<T> fill_;
+  std::vector<T> writing_;
+  std::vector<std::vector<run_file>> levels_;
+  std::future<void> pending_;
+  io_pool pool_;  //  last: joined before the buffers and files it uses go away.
+};
+
+} /* namespace cflc */
+
+//  MARK: - cflc::static_list
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc
+namespace cflc {
+
+/*
+ *  MARK: static_list
+ *  Fixed-capacity forward list with inline node storage and index links,
+ *  usable in constant expressions.  A static_list built and sorted in a
+ *  constexpr initializer lives in read-only data and needs no allocation.
+ *  Slot N is the before_begin sentinel; free slots are chained through next_.
+ *  Exceeding the capacity throws std::length_error (a compile error when
+ *  constant-evaluated).  T must be default constructible.
+ */
+template<typename T, std::size_t N>
+class static_list {
+public:
+  using value_type      = T;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference       = T &;
+  using const_reference = T const &;
+
+  static constexpr size_type npos = N + 1;
+
+  template<bool Const>
+  class basic_iterator {
+    using owner_type = std::conditional_t<Const, static_list const, static_list>;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, T const *, T *>;
+    using reference         = std::conditional_t<Const, T const &, T &>;
+
+    constexpr basic_iterator() = default;
+    constexpr basic_iterator(owner_type * owner, size_type ix) : owner_(owner), ix_(ix) {}
+
+    //  iterator -> const_iterator
+    template<bool C_ = Const, typename = std::enable_if_t<C_>>
+    constexpr basic_iterator(basic_iterator<false> const & other)
+      : owner_(other.owner_), ix_(other.ix_) {}
+
+    constexpr reference operator*() const { return owner_->values_[ix_]; }
+    constexpr pointer operator->() const { return &owner_->values_[ix_]; }
+
+    constexpr basic_iterator & operator++() {
+      ix_ = owner_->next_[ix_];
+      return *this;
+    }
+
+    constexpr basic_iterator operator++(int) {
+      auto tmp = *this;
+      ix_ = owner_->next_[ix_];
+      return tmp;
+    }
+
+    friend constexpr bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) {
+      return lhs.ix_ == rhs.ix_;
+    }
+
+  private:
+    friend class static_list;
+    friend class basic_iterator<!Const>;
+    owner_type * owner_ { nullptr };
+    size_type ix_ { npos };
+  };
+
+  using iterator       = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  constexpr static_list() {
+    for (size_type ix { 0 }; ix < N; ++ix) {
+      next_[ix] = ix + 1 < N ? ix + 1 : npos;
+    }
+    next_[N] = npos;
+    free_ = N != 0 ? 0 : npos;
+  }
+
+  constexpr static_list(std::initializer_list<T> init) : static_list(init.begin(), init.end()) {}
+
+  template<typename InputIt>
+  constexpr static_list(InputIt first, InputIt last) : static_list() {
+    auto tail = before_begin();
+    for (; first != last; ++first) {
+      tail = insert_after(tail, *first);
+    }
+  }
+
+  /// Element access
+  constexpr reference front() { return values_[next_[N]]; }
+  constexpr const_reference front() const { return values_[next_[N]]; }
+
+  /// Iterators
+  constexpr iterator before_begin() noexcept { return iterator(this, N); }
+  constexpr const_iterator before_begin() const noexcept { return cbefore_begin(); }
+  constexpr const_iterator cbefore_begin() const noexcept { return const_iterator(this, N); }
+  constexpr iterator begin() noexcept { return iterator(this, next_[N]); }
+  constexpr const_iterator begin() const noexcept { return cbegin(); }
+  constexpr const_iterator cbegin() const noexcept { return const_iterator(this, next_[N]); }
+  constexpr iterator end() noexcept { return iterator(this, npos); }
+  constexpr const_iterator end() const noexcept { return cend(); }
+  constexpr const_iterator cend() const noexcept { return const_iterator(this, npos); }
+
+  /// Capacity
+  constexpr bool empty() const noexcept { return next_[N] == npos; }
+  constexpr size_type size() const noexcept { return size_; }
+  static constexpr size_type max_size() noexcept { return N; }
+
+  /// Modifiers
+  constexpr void clear() noexcept {
+    while (!empty()) {
+      pop_front();
+    }
+  }
+
+  constexpr iterator insert_after(const_iterator pos, T const & value) {
+    return emplace_after(pos, value);
+  }
+
+  template<typename ... Args>
+  constexpr iterator emplace_after(const_iterator pos, Args && ... args) {
+    auto const ix = allocate();
+    values_[ix] = T(std::forward<Args>(args) ...);
+    next_[ix] = next_[pos.ix_];
+    next_[pos.ix_] = ix;
+    return iterator(this, ix);
+  }
+
+  constexpr iterator erase_after(const_iterator pos) {
+    auto const victim = next_[pos.ix_];
+    next_[pos.ix_] = next_[victim];
+    release(victim);
+    return iterator(this, next_[pos.ix_]);
+  }
+
+  constexpr iterator erase_after(const_iterator pos, const_iterator last) {
+    while (next_[pos.ix_] != last.ix_) {
+      erase_after(pos);
+    }
+    return iterator(this, last.ix_);
+  }
+
+  constexpr void push_front(T const & value) { emplace_after(cbefore_begin(), value); }
+
+  template<typename ... Args>
+  constexpr reference emplace_front(Args && ... args) {
+    return *emplace_after(cbefore_begin(), std::forward<Args>(args) ...);
+  }
+
+  constexpr void pop_front() { erase_after(cbefore_begin()); }
+
+  /// Operations
+  //  Moves the elements in (first, last) to after pos.  Within this list the
+  //  nodes are only relinked (pos must not be in the range); from another
+  //  list the values are copied into this list's storage and erased there.
+  template<size_type M>
+  constexpr void splice_after(const_iterator pos, static_list<T, M> & other,
+                              typename static_list<T, M>::const_iterator first,
+                              typename static_list<T, M>::const_iterator last) {
+    if constexpr (M == N) {
+      if (is_this(other)) {
+        auto const head = next_[first.ix_];
+        if (head == last.ix_ || pos.ix_ == first.ix_) {
+          return;
+        }
+        auto tail = head;
+        while (next_[tail] != last.ix_) {
+          tail = next_[tail];
+        }
+        next_[first.ix_] = last.ix_;
+        next_[tail] = next_[pos.ix_];
+        next_[pos.ix_] = head;
+        return;
+      }
+    }
+
+    for (auto it = std::next(first); it != last; it = other.erase_after(first)) {
+      pos = emplace_after(pos, *it);
+    }
+  }
+
+  //  Moves the element after it to after pos.
+  template<size_type M>
+  constexpr void splice_after(const_iterator pos, static_list<T, M> & other,
+                              typename static_list<T, M>::const_iterator it) {
+    auto const last = std::next(it, 2);
+    if constexpr (M == N) {
+      if (is_this(other) && pos == std::next(it)) {
+        return;
+      }
+    }
+    splice_after(pos, other, it, last);
+  }
+
+  //  Moves all of other's elements to after pos; other must not be *this.
+  template<size_type M>
+  constexpr void splice_after(const_iterator pos, static_list<T, M> & other) {
+    splice_after(pos, other, other.cbefore_begin(), other.cend());
+  }
+
+  template<size_type M>
+  constexpr void splice_after(const_iterator pos, static_list<T, M> && other) {
+    splice_after(pos, other);
+  }
+
+  //  Merges the sorted other into this sorted list; elements from *this come
+  //  first among equals.  Values are copied into this list's storage.
+  template<size_type M, typename Compare = std::less<>>
+  constexpr void merge(static_list<T, M> & other, Compare comp = Compare()) {
+    if (is_this(other)) {
+      return;
+    }
+    auto prev = N;
+    while (!other.empty()) {
+      auto const & value = other.front();
+      while (next_[prev] != npos && !comp(value, values_[next_[prev]])) {
+        prev = next_[prev];
+      }
+      prev = emplace_after(const_iterator(this, prev), value).ix_;
+      other.pop_front();
+    }
+  }
+
+  template<size_type M, typename Compare = std::less<>>
+  constexpr void merge(static_list<T, M> && other, Compare comp = Compare()) {
+    merge(other, comp);
+  }
+
+  template<typename Pred>
+  constexpr size_type remove_if(Pred pred) {
+    size_type removed { 0 };
+    for (auto prev = N; next_[prev] != npos; ) {
+      if (pred(values_[next_[prev]])) {
+        erase_after(const_iterator(this, prev));
+        ++removed;
+      }
+      else {
+        prev = next_[prev];
+      }
+    }
+    return removed;
+  }
+
+  constexpr size_type remove(T const & value) {
+    return remove_if([&value](T const & el) { return el == value; });
+  }
+
+  constexpr void reverse() noexcept {
+    auto rev = npos;
+    for (auto ix = next_[N]; ix != npos; ) {
+      auto const nxt = next_[ix];
+      next_[ix] = rev;
+      rev = ix;
+      ix = nxt;
+    }
+    next_[N] = rev;
+  }
+
+  template<typename BinaryPred = std::equal_to<>>
+  constexpr size_type unique(BinaryPred pred = BinaryPred()) {
+    size_type removed { 0 };
+    for (auto ix = next_[N]; ix != npos && next_[ix] != npos; ) {
+      if (pred(values_[ix], values_[next_[ix]])) {
+        erase_after(const_iterator(this, ix));
+        ++removed;
+      }
+      else {
+        ix = next_[ix];
+      }
+    }
+    return removed;
+  }
+
+  //  Stable bottom-up merge sort on the links; values never move.
+  template<typename Compare = std::less<>>
+  constexpr void sort(Compare comp = Compare()) {
+    auto head = next_[N];
+    if (head == npos) {
+      return;
+    }
+
+    for (size_type width { 1 }; ; width *= 2) {
+      auto left = head;
+      auto tail = npos;
+      size_type merges { 0 };
+      head = npos;
+
+      while (left != npos) {
+        ++merges;
+        auto right = left;
+        size_type lsize { 0 };
+        while (lsize < width && right != npos) {
+          right = next_[right];
+          ++lsize;
+        }
+        size_type rsize { width };
+
+        while (lsize > 0 || (rsize > 0 && right != npos)) {
+          size_type take;
+          if (lsize == 0) {
+            take = right;
+            right = next_[right];
+            --rsize;
+          }
+          else if (rsize == 0 || right == npos || !comp(values_[right], values_[left])) {
+            take = left;
+            left = next_[left];
+            --lsize;
+          }
+          else {
+            take = right;
+            right = next_[right];
+            --rsize;
+          }
+          if (tail == npos) {
+            head = take;
+          }
+          else {
+            next_[tail] = take;
+          }
+          tail = take;
+        }
+        left = right;
+      }
+      next_[tail] = npos;
+
+      if (merges <= 1) {
+        break;
+      }
+    }
+    next_[N] = head;
+  }
+
+private:
+  template<size_type M>
+  constexpr bool is_this(static_list<T, M> const & other) const noexcept {
+    return static_cast<void const *>(&other) == static_cast<void const *>(this);
+  }
+
+  constexpr size_type allocate() {
+    if (free_ == npos) {
+      throw std::length_error("static_list: capacity exceeded");
+    }
+    auto const ix = free_;
+    free_ = next_[ix];
+    ++size_;
+    return ix;
+  }
+
+  constexpr void release(size_type ix) {
+    values_[ix] = T();
+    next_[ix] = free_;
+    free_ = ix;
+    --size_;
+  }
+
+  std::array<T, N> values_ {};
+  std::array<size_type, N + 1> next_ {};
+  size_type free_ { npos };
+  size_type size_ { 0 };
+};
+
+template<typename T, std::size_t N, std::size_t M>
+constexpr bool operator==(static_list<T, N> const & lhs, static_list<T, M> const & rhs) {
+  return lhs.size() == rhs.size()
+      && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, std::size_t N, std::size_t M>
+constexpr auto operator<=>(static_list<T, N> const & lhs, static_list<T, M> const & rhs) {
+  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+                                                rhs.begin(), rhs.end());
+}
+
+} /* namespace cflc */
+
+//  MARK: - cflc::shared_batch_list
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc
+namespace cflc {
+
+/*
+ *  MARK: shared_batch_list
+ *  Lock-free multi-producer list that is published to and drained a batch at
+ *  a time.  A producer builds a batch locally (push_front/emplace_front, as
+ *  with a std::forward_list), then publish() links the batch's tail to the
+ *  current head and installs the batch's head with one CAS.  A consumer takes
+ *  everything with one exchange in detach(); the most recently published
+ *  batch comes first.  Nothing is ever popped singly, so there is no ABA.
+ */
+template<typename T>
+class shared_batch_list {
+  struct node {
+    T value;
+    node * next { nullptr };
+
+    template<typename ... Args>
+    explicit node(Args && ... args) : value(std::forward<Args>(args) ...) {}
+  };
+
+public:
+  using value_type = T;
+  using size_type  = std::size_t;
+
+  /*
+   *  MARK: batch
+   *  Producer-local chain of nodes, and the result of detach().
+   */
+  class batch {
+  public:
+    template<bool Const>
+    class basic_iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type        = T;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = std::conditional_t<Const, T const *, T *>;
+      using reference         = std::conditional_t<Const, T const &, T &>;
+
+      basic_iterator() = default;
+      explicit basic_iterator(node * nd) : nd_(nd) {}
+
+      reference operator*() const { return nd_->value; }
+      pointer operator->() const { return &nd_->value; }
+
+      basic_iterator & operator++() {
+        nd_ = nd_->next;
+        return *this;
+      }
+
+      basic_iterator operator++(int) {
+        auto tmp = *this;
+        nd_ = nd_->next;
+        return tmp;
+      }
+
+      friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) {
+        return lhs.nd_ == rhs.nd_;
+      }
+
+      friend bool operator!=(basic_iterator const & lhs, basic_iterator const & rhs) {
+        return lhs.nd_ != rhs.nd_;
+      }
+
+    private:
+      node * nd_ { nullptr };
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    batch() = default;
+
+    //  Moves lst's values into a batch, keeping their order.
+    explicit batch(std::forward_list<T> && lst) {
+      for (auto & el : lst) {
+        push_back(std::move(el));
+      }
+      lst.clear();
+    }
+
+    batch(batch const &) = delete;
+    batch & operator=(batch const &) = delete;
+
+    batch(batch && other) noexcept
+      : head_(std::exchange(other.head_, nullptr)),
+        tail_(std::exchange(other.tail_, nullptr)) {}
+
+    batch & operator=(batch && other) noexcept {
+      if (this != &other) {
+        clear();
+        head_ = std::exchange(other.head_, nullptr);
+        tail_ = std::exchange(other.tail_, nullptr);
+      }
+      return *this;
+    }
+
+    ~batch() { clear(); }
+
+    iterator begin() noexcept { return iterator(head_); }
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator begin() const noexcept { return const_iterator(head_); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+
+    bool empty() const noexcept { return head_ == nullptr; }
+
+    T & front() { return head_->value; }
+
+    void push_front(T const & value) { emplace_front(value); }
+    void push_front(T && value) { emplace_front(std::move(value)); }
+
+    template<typename ... Args>
+    T & emplace_front(Args && ... args) {
+      auto nd = new node(std::forward<Args>(args) ...);
+      nd->next = head_;
+      if (head_ == nullptr) {
+        tail_ = nd;
+      }
+      head_ = nd;
+      return nd->value;
+    }
+
+    void push_back(T && value) {
+      auto nd = new node(std::move(value));
+      if (head_ == nullptr) {
+        head_ = nd;
+      }
+      else {
+        last()->next = nd;
+      }
+      tail_ = nd;
+    }
+
+    void pop_front() {
+      auto victim = head_;
+      head_ = head_->next;
+      if (head_ == nullptr) {
+        tail_ = nullptr;
+      }
+      delete victim;
+    }
+
+    void clear() noexcept {
+      while (head_ != nullptr) {
+        auto victim = head_;
+        head_ = head_->next;
+        delete victim;
+      }
+      tail_ = nullptr;
+    }
+
+  private:
+    friend class shared_batch_list;
+
+    //  A detached batch doesn't know its tail until it is needed.
+    explicit batch(node * head) : head_(head) {}
+
+    node * last() noexcept {
+      if (tail_ == nullptr) {
+        for (tail_ = head_; tail_->next != nullptr; tail_ = tail_->next) {}
+      }
+      return tail_;
+    }
+
+    auto release() noexcept -> std::pair<node *, node *> {
+      auto chain = std::make_pair(head_, last());
+      head_ = tail_ = nullptr;
+      return chain;
+    }
+
+    node * head_ { nullptr };
+    node * tail_ { nullptr };
+  };
+
+  shared_batch_list() = default;
+  shared_batch_list(shared_batch_list const &) = delete;
+  shared_batch_list & operator=(shared_batch_list const &) = delete;
+
+  ~shared_batch_list() { detach(); }
+
+  //  Publishes the whole batch with a single successful CAS.
+  void publish(batch && bat) noexcept {
+    if (bat.empty()) {
+      return;
+    }
+    auto [first, last] = bat.release();
+    auto head = head_.load(std::memory_order_relaxed);
+    do {
+      last->next = head;
+    } while (!head_.compare_exchange_weak(head, first,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
+  }
+
+  //  Takes every published element with a single exchange.
+  auto detach() noexcept -> batch {
+    return batch(head_.exchange(nullptr, std::memory_order_acquire));
+  }
+
+  bool empty() const noexcept {
+    return head_.load(std::memory_order_acquire) == nullptr;
+  }
+
+private:
+  std::atomic<node *> head_ { nullptr };
+};
+
+} /* namespace cflc */
+
+//  MARK: - cflc::regress
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  MARK: namespace cflc::regress
+namespace cflc::regress {
+
+/*
+ *  MARK: options
+ *  Command line for the regression harness:
+ *    --regress [--baseline FILE] [--threshold PCT] [--floor PCT]
+ *              [--scale N] [--repeat N] [--sample MS] [--update-baseline]
+ *  Any of the options implies --regress.
+ */
+struct options {
+  std::string baseline { "flists_baseline.txt"s };
+  double threshold { 25.0 };      //  percent slower than baseline that fails
+  double floor { 5.0 };           //  ignore slow-downs under this percent of baseline
+  std::size_t scale { 200'000 };  //  elements per list
+  std::size_t repeat { 7 };       //  median of repeat samples is recorded
+  double sample_ms { 20.0 };      //  each sample times a case for at least this long
+  bool update { false };
+};
+
+auto usage() -> std::string {
+  return "usage: CF.STL_Containers_Forward_list --regress [--baseline FILE]\n"s
+         "         [--threshold PCT] [--floor PCT] [--scale N] [--repeat N]\n"s
+         "         [--sample MS] [--update-baseline]\n"s;
+}
+
+//  Whole-string conversion; anything else (including a negative count) is
+//  reported as std::invalid_argument naming the flag.
+template<typename Number>
+auto to_number(std::string_view flag, std::string const & text) -> Number {
+  std::size_t used { 0 };
+  Number value {};
+  try {
+    if constexpr (std::is_floating_point_v<Number>) {
+      value = static_cast<Number>(std::stod(text, &used));
+    }
+    else if (!text.empty() && text.front() != '-') {
+      value = static_cast<Number>(std::stoull(text, &used));
+    }
+  }
+  catch (std::logic_error const &) {
+    used = 0;
+  }
+  if (text.empty() || used != text.size() || !(value >= Number { 0 })) {
+    throw std::invalid_argument(std::string(flag) + ": invalid value '"s + text + "'"s);
+  }
+  return value;
+}
+
+auto parse(int argc, const char * argv[]) -> options {
+  options opts;
+  for (int ax { 1 }; ax < argc; ++ax) {
+    std::string_view arg { argv[ax] };
+    auto value = [&]() -> std::string {
+      if (ax + 1 >= argc) {
+        throw std::invalid_argument(std::string(arg) + ": missing value"s);
+      }
+      return argv[++ax];
+    };
+
+    if (arg == "--regress") { }
+    else if (arg == "--baseline") { opts.baseline = value(); }
+    else if (arg == "--threshold") { opts.threshold = to_number<double>(arg, value()); }
+    else if (arg == "--floor") { opts.floor = to_number<double>(arg, value()); }
+    else if (arg == "--scale") { opts.scale = to_number<std::size_t>(arg, value()); }
+    else if (arg == "--repeat") { opts.repeat = to_number<std::size_t>(arg, value()); }
+    else if (arg == "--sample") { opts.sample_ms = to_number<double>(arg, value()); }
+    else if (arg == "--update-baseline") { opts.update = true; }
+    else {
+      throw std::invalid_argument("unknown option '"s + std::string(arg) + "'"s);
+    }
+  }
+
+  if (opts.scale == 0 || opts.repeat == 0) {
+    throw std::invalid_argument("--scale and --repeat must be at least 1"s);
+  }
+  return opts;
+}
+
+/*
+ *  MARK: stopwatch
+ *  Accumulates the time spent inside laps, so a case can exclude its setup
+ *  and its reference computation from the recorded time.
+ */
+class stopwatch {
+  using clock = std::chrono::steady_clock;
+
+public:
+  class lap {
+  public:
+    explicit lap(stopwatch & sw) : sw_(sw), start_(clock::now()) {}
+    ~lap() { sw_.total_ += clock::now() - start_; }
+
+  private:
+    stopwatch & sw_;
+    clock::time_point start_;
+  };
+
+  auto time() -> lap { return lap(*this); }
+
+  auto ms() const -> double {
+    return std::chrono::duration<double, std::milli>(total_).count();
+  }
+
+  auto elapsed() const -> double {
+    return std::chrono::duration<double, std::milli>(clock::now() - created_).count();
+  }
+
+private:
+  clock::duration total_ { 0 };
+  clock::time_point created_ { clock::now() };
+};
+
+//  A case's printed candidate and reference results; they must be equal.
+using outputs = std::pair<std::string, std::string>;
+
+template<typename Container>
+auto print(Container const & cnt) -> std::string {
+  std::ostringstream os;
+  os << cnt;
+  return os.str();
+}
+
+/*
+ *  MARK: sample
+ *  One timing sample of a case: the case is rerun until its laps add up to
+ *  min_ms, or the wall clock reaches ten times that when setup dominates,
+ *  and the mean lap time per run is returned.  Short cases are otherwise
+ *  at the mercy of the clock and the scheduler.
+ */
+template<typename Case>
+auto sample(Case const & run, double min_ms, bool & match) -> double {
+  stopwatch sw;
+  std::size_t runs { 0 };
+  do {
+    auto [cand, ref] = run(sw);
+    match = match && cand == ref;
+    ++runs;
+  } while (sw.ms() < min_ms && sw.elapsed() < 10.0 * min_ms);
+  return sw.ms() / static_cast<double>(runs);
+}
+
+//  median and median absolute deviation of the samples.
+struct timing {
+  double ms;
+  double spread;
+};
+
+auto summarise(std::vector<double> samples) -> timing {
+  auto median = [](std::vector<double> & xs) {
+    auto mid = xs.begin() + xs.size() / 2;
+    std::nth_element(xs.begin(), mid, xs.end());
+    auto md = *mid;
+    if (xs.size() % 2 == 0) {
+      md = (md + *std::max_element(xs.begin(), mid)) / 2.0;
+    }
+    return md;
+  };
+  auto const ms = median(samples);
+  for (auto & sx : samples) {
+    sx = std::abs(sx - ms);
+  }
+  return { ms, median(samples) };
+}
+
+//  Timings only compare between runs at the same --scale and --sample, so
+//  the baseline records both.
+struct baseline_type {
+  std::size_t scale { 0 };
+  double sample_ms { 0.0 };
+  std::vector<std::pair<std::string, timing>> timings;
+
+  auto same_options(baseline_type const & other) const -> bool {
+    return scale == other.scale && sample_ms == other.sample_ms;
+  }
+};
+
+//  "# scale N sample MS", then "name ms spread" per line.  A file without
+//  that header loads with scale 0.
+auto load_baseline(std::string const & path) -> std::optional<baseline_type> {
+  std::ifstream in(path);
+  if (!in) {
+    return std::nullopt;
+  }
+  baseline_type baseline;
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream is(line);
+    std::string name;
+    if (line.starts_with('#')) {
+      std::string scale, sample;
+      if (!(is >> name >> scale >> baseline.scale >> sample >> baseline.sample_ms)
+          || scale != "scale" || sample != "sample") {
+        baseline.scale = 0;
+      }
+      continue;
+    }
+    timing tm { 0.0, 0.0 };
+    if (is >> name >> tm.ms >> tm.spread) {
+      baseline.timings.emplace_back(name, tm);
+    }
+  }
+  return baseline;
+}
+
+void save_baseline(std::string const & path, baseline_type const & baseline) {
+  std::ofstream out(path);
+  if (!out) {
+    throw std::runtime_error("cannot write baseline "s + path);
+  }
+  //  sample_ms is written exactly, so same_options holds after a reload.
+  out << "# scale "s << baseline.scale << " sample "s
+      << std::setprecision(std::numeric_limits<double>::max_digits10)
+      << baseline.sample_ms << '\n';
+  out << std::fixed << std::setprecision(4);
+  for (auto const & [name, tm] : baseline.timings) {
+    out << name << ' ' << tm.ms << ' ' << tm.spread << '\n';
+  }
+}
+
+} /* namespace cflc::regress */
+
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list()
+ */
+auto C_forward_list(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
+  /// Member functions
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::forward_list - constructor"s << '\n';
+  {
+    using namespace cflc;
+
+    // c++11 initializer list syntax:
+    std::forward_list<std::string> words1 {"the"s, "frogurt"s, "is"s, "also"s, "cursed"s};
+    std::cout << "words1: "s << words1 << '\n';
+
+    // words2 == words1
+    std::forward_list<std::string> words2(words1.begin(), words1.end());
+    std::cout << "words2: "s << words2 << '\n';
+
+    // words3 == words1
+    std::forward_list<std::string> words3(words1);
+    std::cout << "words3: "s << words3 << '\n';
+
+    // words4 is {"Mo", "Mo", "Mo", "Mo", "Mo"}
+    std::forward_list<std::string> words4(5, "Mo"s);
+    std::cout << "words4: "s << words4 << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - operator="s << '\n';
+  {
+    auto display_sizes = [](std::forward_list<int> const & nums1,
+                            std::forward_list<int> const & nums2,
+                            std::forward_list<int> const & nums3) {
+        std::cout << "nums1: "s << std::distance(nums1.begin(), nums1.end())
+                  << " nums2: "s << std::distance(nums2.begin(), nums2.end())
+                  << " nums3: "s << std::distance(nums3.begin(), nums3.end()) << '\n';
+    };
+
+    std::forward_list<int> nums1 { 3, 1, 4, 6, 5, 9, };
+    std::forward_list<int> nums2;
+    std::forward_list<int> nums3;
+
+    std::cout << "Initially:\n";
+    display_sizes(nums1, nums2, nums3);
+
+    // copy assignment copies data from nums1 to nums2
+    nums2 = nums1;
+
+    std::cout << "After assigment:\n";
+    display_sizes(nums1, nums2, nums3);
+
+    // move assignment moves data from nums1 to nums3,
+    // modifying both nums1 and nums3
+    nums3 = std::move(nums1);
+
+    std::cout << "After move assigment:\n";
+    display_sizes(nums1, nums2, nums3);
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - assign"s << '\n';
+  {
+    std::forward_list<char> characters;
+
+    auto print_forward_list = [&](){
+      for (char chr : characters) {
+        std::cout << chr << ' ';
+      }
+      std::cout << '\n';
+    };
+
+    characters.assign(5, 'a');
+    print_forward_list();
+
+    std::string const extra(6, 'b');
+    characters.assign(extra.begin(), extra.end());
+    print_forward_list();
+
+    characters.assign({ 'C', '+', '+', '1', '1', });
+    print_forward_list();
+
+    std::cout << '\n';
+  }
+
+  /// Element access
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - front"s << '\n';
+  {
+    std::forward_list<char> letters { 'o', 'm', 'g', 'w', 't', 'f' };
+
+    if (!letters.empty()) {
+      std::cout << "The first character is '"s << letters.front() << "'.\n"s;
+    }
+
+    std::cout << '\n';
+  }
+
+  /// Iterators
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - before_begin, cbefore_begin"s << '\n';
+  {
+    auto prlist = [](auto ln) {
+      std::cout << ln << '\n';
+    };
+
+    std::forward_list slist {
+      "O for a Muse of fire, that would ascend"s,
+      "The brightest heaven of invention,"s,
+      "A kingdom for a stage, princes to act"s,
+      "And monarchs to behold the swelling scene!"s,
+    };
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    auto toinsert = std::vector {
+      "The Life of King Henry the Fifth."s,
+      "Act I."s,
+      "Prolog.\n"s
+    };
+
+    auto it = slist.before_begin();
+    std::for_each(toinsert.crbegin(), toinsert.crend(), [&](auto ln) {
+      slist.insert_after(it, ln);
+    });
+
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// Iterators
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - begin, cbegin"s << '\n';
+  {
+    std::forward_list<int> nums { 1, 2, 4, 8, 16, };
+    std::forward_list<std::string> fruits {"orange"s, "apple"s, "raspberry"s};
+    std::forward_list<char> empty;
+
+    // Print forward_list.
+    std::for_each(nums.begin(), nums.end(), [](const int nr) { std::cout << nr << ' '; });
+    std::cout << '\n';
+
+    // Sums all integers in the forward_list nums (if any), printing only the result.
+    std::cout << "Sum of nums: "s
+              << std::accumulate(nums.begin(), nums.end(), 0) << '\n';
+
+    // Prints the first fruit in the forward_list fruits, checking if there is any.
+    if (!fruits.empty()) {
+      std::cout << "First fruit: "s << *fruits.begin() << '\n';
+    }
+
+    if (empty.begin() == empty.end()) {
+      std::cout << "forward_list 'empty' is indeed empty.\n"s;
+    }
+
+    std::cout << '\n';
+  }
+
+  /// Capacity
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - empty"s << '\n';
+  {
+    std::forward_list<int> numbers;
+    std::cout << std::boolalpha;
+    std::cout << "Initially, numbers.empty(): "s << numbers.empty() << '\n';
+
+    numbers.push_front(42);
+    numbers.push_front(13'317);
+    std::cout << "After adding elements, numbers.empty(): "s << numbers.empty() << '\n';
+    std::cout << std::noboolalpha;
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - max_size"s << '\n';
+  {
+    std::forward_list<char> s;
+    std::cout << "Maximum size of a 'forward_list' is "s << s.max_size() << "\n"s;
+
+    std::cout << '\n';
+  }
+
+  /// Modifiers
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - clear"s << '\n';
+  {
+    std::forward_list<int> container{ 1, 2, 3, };
+
+    auto print = [](int const & nr) { std::cout << " "s << nr; };
+
+    std::cout << "Before clear:"s;
+    std::for_each(container.begin(), container.end(), print);
+    std::cout << '\n';
+
+    std::cout << "Clear\n"s;
+    container.clear();
+
+    std::cout << "After clear:"s;
+    std::for_each(container.begin(), container.end(), print);
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - insert_after"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<std::string> words {
+      "the"s, "frogurt"s, "is"s, "also"s, "cursed"s,
+    };
+
+    std::cout << "words: "s << words << '\n';
+
+    // insert_after (2)
+    auto beginIt = words.begin();
+    words.insert_after(beginIt, "strawberry"s);
+    std::cout << "words: "s << words << '\n';
+
+    // insert_after (3)
+    auto anotherIt = beginIt;
+    ++anotherIt;
+    anotherIt = words.insert_after(anotherIt, 2, "strawberry"s);
+    std::cout << "words: "s << words << '\n';
+
+    // insert_after (4)
+    std::vector<std::string> V = { "apple"s, "banana"s, "cherry"s, };
+    anotherIt = words.insert_after(anotherIt, V.begin(), V.end());
+    std::cout << "words: "s << words << '\n';
+
+    // insert_after (5)
+    words.insert_after(anotherIt, { "jackfruit"s, "kiwifruit"s, "lime"s, "mango"s, });
+    std::cout << "words: "s << words << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - insert_after"s << '\n';
+  {
+    struct Sum {
+      std::string remark;
+      int sum;
+
+      Sum(std::string remark, int sum)
+        : remark{std::move(remark)}, sum{sum} {}
+
+      void print() const {
+        std::cout << remark << " = "s << sum << '\n';
+      }
+    };
+
+    std::forward_list<Sum> list;
+
+    auto iter = list.before_begin();
+    std::string str { "1"s };
+    for (int ix { 1 }, sum { 1 }; ix != 10; sum += ix) {
+      iter = list.emplace_after(iter, str, sum);
+      ++ix;
+      str += " + "s + std::to_string(ix);
+    }
+
+    for (Sum const & s_ : list) {
+      s_.print();
+    }
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - erase_after"s << '\n';
+  {
+    std::forward_list<int> lnrs = { 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+
+//    l.erase( l.begin() ); // ERROR: No function erase
+
+    lnrs.erase_after( lnrs.before_begin() ); // Removes first element
+
+    for( auto n : lnrs ) std::cout << n << " "s;
+    std::cout << '\n';
+
+    auto fi = std::next( lnrs.begin() );
+    auto la = std::next( fi, 3 );
+
+    lnrs.erase_after( fi, la );
+
+    for( auto n : lnrs ) std::cout << n << " "s;
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - push_front"s << '\n';
+  {
+    auto prlist = [](auto ln) {
+      std::cout << ln << '\n';
+    };
+
+    std::forward_list slist {
+      "O for a Muse of fire, that would ascend"s,
+      "The brightest heaven of invention,"s,
+      "A kingdom for a stage, princes to act"s,
+      "And monarchs to behold the swelling scene!"s,
+    };
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    auto toinsert = std::vector {
+      "The Life of King Henry the Fifth."s,
+      "Act I."s,
+      "Prolog.\n"s
+    };
+
+    std::for_each(toinsert.crbegin(), toinsert.crend(), [&](auto ln) {
+      slist.push_front(ln);
+    });
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - emplace_front"s << '\n';
+  {
+    auto prlist = [](auto ln) {
+      std::cout << ln << '\n';
+    };
+
+    std::forward_list slist {
+      "O for a Muse of fire, that would ascend"s,
+      "The brightest heaven of invention,"s,
+      "A kingdom for a stage, princes to act"s,
+      "And monarchs to behold the swelling scene!"s,
+    };
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    auto toinsert = std::vector {
+      "The Life of King Henry the Fifth."s,
+      "Act I."s,
+      "Prolog.\n"s
+    };
+
+    std::for_each(toinsert.crbegin(), toinsert.crend(), [&](auto ln) {
+      slist.emplace_front(ln);
+    });
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - pop_front"s << '\n';
+  {
+    auto prlist = [](auto ln) {
+      std::cout << ln << '\n';
+    };
+
+    std::forward_list slist {
+      "The Life of King Henry the Fifth."s,
+      "Act I."s,
+      "Prolog.\n"s,
+      "O for a Muse of fire, that would ascend"s,
+      "The brightest heaven of invention,"s,
+      "A kingdom for a stage, princes to act"s,
+      "And monarchs to behold the swelling scene!"s,
+    };
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    for (auto ix(0u); ix < 3u; ++ix) {
+      slist.pop_front();
+    }
+
+    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - resize"s << '\n';
+  {
+    auto pc = [](auto el) {
+      std::cout << el << ' ';
+    };
+
+    std::forward_list<int> container = { 1, 2, 3, };
+    std::cout << "The forward_list holds: "s;
+    std::for_each(container.cbegin(), container.cend(), pc);
+    std::cout << '\n';
+
+    container.resize(5);
+    std::cout << "After resize up to 5: "s;
+    std::for_each(container.cbegin(), container.cend(), pc);
+    std::cout << '\n';
+
+    container.resize(2);
+    std::cout << "After resize down to 2: "s;
+    std::for_each(container.cbegin(), container.cend(), pc);
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - swap"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> a1 { 1, 2, 3, }, a2 { 4, 5, };
+
+    auto it1 = std::next(a1.begin());
+    auto it2 = std::next(a2.begin());
+
+    int & ref1 = a1.front();
+    int & ref2 = a2.front();
+
+    std::cout << a1 << a2 << *it1 << ' ' << *it2 << ' ' << ref1 << ' ' << ref2 << '\n';
+    a1.swap(a2);
+    std::cout << a1 << a2 << *it1 << ' ' << *it2 << ' ' << ref1 << ' ' << ref2 << '\n';
+
+    // Note that after swap the iterators and references stay associated with their
+    // original elements, e.g. it1 that pointed to an element in 'a1' with value 2
+    // still points to the same element, though this element was moved into 'a2'.
+
+    std::cout << '\n';
+  }
+
+  /// Operations
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - merge"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> list1 = { 5, 9, 0, 1, 3, };
+    std::forward_list<int> list2 = { 8, 7, 2, 6, 4, };
+
+    list1.sort();
+    list2.sort();
+    std::cout << "list1:  "s << list1 << '\n';
+    std::cout << "list2:  "s << list2 << '\n';
+    list1.merge(list2);
+    std::cout << "merged: "s << list1 << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// Operations
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - splice_after"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> l1 = { 1, 2, 3, 4, 5, };
+    std::forward_list<int> l2 = { 10, 11, 12, };
+
+    std::cout << l1 << '\n';
+    std::cout << l2 << '\n';
+
+    l2.splice_after(l2.cbegin(), l1, l1.cbegin(), l1.cend());
+    // not equivalent to l2.splice_after(l2.cbegin(), l1);
+
+    std::cout << l1 << '\n';
+    std::cout << l2 << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - remove, remove_if"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> lst = { 1, 100, 2, 3, 10, 1, 11, -1, 12, };
+    std::cout << lst << '\n';
+
+    lst.remove(1); // remove both elements equal to 1
+    std::cout << lst << '\n';
+
+    lst.remove_if([](int nr){ return nr > 10; }); // remove all elements greater than 10
+    std::cout << lst << '\n';
+
+//    for (int n_ : lst) {
+//      std::cout << n_ << ' ';
+//    }
+//    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - reverse"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> list = { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
+
+    std::cout << "before:     "s << list << '\n';
+
+    list.sort();
+    std::cout << "ascending:  "s << list << '\n';
+
+    list.reverse();
+    std::cout << "descending: "s << list << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - unique"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> l_nr = { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
+
+    std::cout << "contents before:         " << l_nr << '\n';
+//    for (auto val : l_nr)
+//      std::cout << ' ' << val;
+//    std::cout << '\n';
+
+    l_nr.unique();
+    std::cout << "contents after unique(): " << l_nr << '\n';
+//    for (auto val : l_nr)
+//      std::cout << ' ' << val;
+    std::cout << '\n';
+
+    std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - sort"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> list = { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
+
+    std::cout << "before:     "s << list << '\n';
+
+    list.sort();
+    std::cout << "ascending:  "s << list << '\n';
+
+    list.sort(std::greater<int>());
+    std::cout << "descending: "s << list << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// Non-member functions
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - std::operator==, etc."s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> alice{ 1, 2, 3, };
+    std::forward_list<int> bob{ 7, 8, 9, 10, };
+    std::forward_list<int> eve{ 1, 2, 3, };
+
+    std::cout << std::boolalpha;
+
+    // Compare non equal containers
+    std::cout << "alice == bob returns "s << (alice == bob) << '\n';
+    std::cout << "alice != bob returns "s << (alice != bob) << '\n';
+    std::cout << "alice <  bob returns "s << (alice < bob) << '\n';
+    std::cout << "alice <= bob returns "s << (alice <= bob) << '\n';
+    std::cout << "alice >  bob returns "s << (alice > bob) << '\n';
+    std::cout << "alice >= bob returns "s << (alice >= bob) << '\n';
+
+    std::cout << '\n';
+
+    // Compare equal containers
+    std::cout << "alice == eve returns " << (alice == eve) << '\n';
+    std::cout << "alice != eve returns " << (alice != eve) << '\n';
+    std::cout << "alice <  eve returns " << (alice < eve) << '\n';
+    std::cout << "alice <= eve returns " << (alice <= eve) << '\n';
+    std::cout << "alice >  eve returns " << (alice > eve) << '\n';
+    std::cout << "alice >= eve returns " << (alice >= eve) << '\n';
+
+    std::cout << '\n';
+
+#if (__cplusplus > 201707L)
+    //  TODO:  add spaceship operator tests
+    auto eq = std::is_eq  (alice <=> eve);
+    auto ne = std::is_neq (alice <=> eve);
+    auto lt = std::is_lt  (alice <=> eve);
+    auto le = std::is_lteq(alice <=> eve);
+    auto gt = std::is_gt  (alice <=> eve);
+    auto ge = std::is_gteq(alice <=> eve);
+#endif  /* (__cplusplus > 201707L) */
+
+    std::cout << std::boolalpha;
+
+    std::cout << '\n';
+  }
+
+  /// Non-member functions
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - std::swap"s << '\n';
+  {
+    using namespace cflc;
+
+    std::forward_list<int> alice { 1, 2, 3, };
+    std::forward_list<int> bob   { 7, 8, 9, 10, };
+
+    // Print state before swap
+    std::cout << "before [alice]: "s << alice << '\n';
+    std::cout << "       [bob]  : "s << bob << '\n';
+
+    std::cout << "-- SWAP\n";
+    std::swap(alice, bob);
+
+    // Print state after swap
+    std::cout << "after  [alice]: "s << alice << '\n';
+    std::cout << "       [bob]  : "s << bob << '\n';
+
+    std::cout << '\n';
+  }
+
+  /// Non-member functions
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "std::C_forward_list - std::erase, std::erase_if"s << '\n';
+  {
+    auto print_container = [](std::string_view comment,
+                              std::forward_list<char> const & chars) {
+      std::cout << comment;
+      for (auto cx : chars) {
+        std::cout << cx << ' ';
+      }
+      std::cout << '\n';
+    };
+
+    std::forward_list<char> cnt(10);
+    std::iota(cnt.begin(), cnt.end(), '0');
+    print_container("Init:\n"s, cnt);
+
+    std::erase(cnt, '3');
+    print_container("Erase '3':\n"s, cnt);
+
+#if (__cplusplus > 201707L)
+  //`TODO:  add C++20 feature tests
+    auto erased = std::erase_if(cnt, [](char x) { return (x - '0') % 2 == 0; });
+    print_container("Erase all even numbers:\n"s, cnt);
+    std::cout << "In all " << erased << " even numbers were erased.\n"s;
+#endif  /* (__cplusplus > 201707L) */
+
+    std::cout << '\n';
+  }
+
+  std::cout << std::endl; //  make sure cout is flushed.
+
+  return 0;
+}
+
+//  MARK: - C_forward_list
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list()
+ */
+auto C_forward_list_deduction_guides(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
+  /// Member functions
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - insert_after"s << '\n';
+  std::cout << "std::forward_list - deduction guides"s << '\n';
   {
-    using namespace cflc;
+    std::vector<int> vec = { 1, 2, 3, 4, };
 
-    std::forward_list<std::string> words {
-      "the"s, "frogurt"s, "is"s, "also"s, "cursed"s,
-    };
+    // uses explicit deduction guide to deduce std::forward_list<int>
+    std::forward_list xlst(vec.begin(), vec.end());
+    std::for_each(xlst.cbegin(), xlst.cend(), [](auto x_) {
+      std::cout << std::setw(4) << x_;
+    });
+    std::cout << '\n';
 
-    std::cout << "words: "s << words << '\n';
+    // deduces std::forward_list<std::vector<int>::iterator>
+    // first phase of overload resolution for list-initialization selects the candidate
+    // synthesized from the initializer-list constructor; second phase is not performed
+    // and deduction guide has no effect
+    std::forward_list ylst { vec.begin(), vec.end() };
+    auto i1 = ylst.front();
+    ylst.reverse();
+    auto i2 = ylst.front();
+    auto acc = std::accumulate(i1, i2, 0, std::plus<>());
+    std::cout << std::setw(4) << acc << '\n';
 
-    // insert_after (2)
-    auto beginIt = words.begin();
-    words.insert_after(beginIt, "strawberry"s);
-    std::cout << "words: "s << words << '\n';
+    std::cout << '\n';
+  }
 
-    // insert_after (3)
-    auto anotherIt = beginIt;
-    ++anotherIt;
-    anotherIt = words.insert_after(anotherIt, 2, "strawberry"s);
-    std::cout << "words: "s << words << '\n';
+  std::cout << std::endl; //  make sure cout is flushed.
 
-    // insert_after (4)
-    std::vector<std::string> V = { "apple"s, "banana"s, "cherry"s, };
-    anotherIt = words.insert_after(anotherIt, V.begin(), V.end());
-    std::cout << "words: "s << words << '\n';
+  return 0;
 
-    // insert_after (5)
-    words.insert_after(anotherIt, { "jackfruit"s, "kiwifruit"s, "lime"s, "mango"s, });
-    std::cout << "words: "s << words << '\n';
+}
 
-    std::cout << '\n';
-  }
+
+//  MARK: - C_forward_list_tail_list
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list_tail_list()
+ */
+auto C_forward_list_tail_list(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
 
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - insert_after"s << '\n';
+  std::cout << "cflc::tail_list - emplace_back"s << '\n';
   {
     struct Sum {
       std::string remark;
@@ -362,12 +3348,12 @@ auto C_forward_list(int argc, const char * argv[]) -> decltype(argc) {
       }
     };
 
-    std::forward_list<Sum> list;
+    //  same list as the emplace_after example, without carrying iter by hand.
+    cflc::tail_list<Sum> list;
 
-    auto iter = list.before_begin();
     std::string str { "1"s };
     for (int ix { 1 }, sum { 1 }; ix != 10; sum += ix) {
-      iter = list.emplace_after(iter, str, sum);
+      list.emplace_back(str, sum);
       ++ix;
       str += " + "s + std::to_string(ix);
     }
@@ -375,403 +3361,726 @@ auto C_forward_list(int argc, const char * argv[]) -> decltype(argc) {
     for (Sum const & s_ : list) {
       s_.print();
     }
+    std::cout << "back: "s;
+    list.back().print();
 
     std::cout << '\n';
   }
 
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - erase_after"s << '\n';
+  std::cout << "cflc::tail_list - push_back, splice_back, pop_front (FIFO)"s << '\n';
   {
-    std::forward_list<int> lnrs = { 1, 2, 3, 4, 5, 6, 7, 8, 9, };
+    using namespace cflc;
 
-//    l.erase( l.begin() ); // ERROR: No function erase
+    tail_list<int> queue;
+    queue.push_back(1);
+    queue.push_back(2);
+    std::cout << "queue: "s << queue << '\n';
 
-    lnrs.erase_after( lnrs.before_begin() ); // Removes first element
+    //  producer batches are appended whole, no walk to find the end.
+    for (int batch { 0 }; batch < 3; ++batch) {
+      tail_list<int> local;
+      for (int ix { 0 }; ix < 3; ++ix) {
+        local.push_back(10 * (batch + 1) + ix);
+      }
+      queue.splice_back(local);
+      std::cout << "queue: "s << queue
+                << " size: "s << queue.size()
+                << " back: "s << queue.back()
+                << " local: "s << local << '\n';
+    }
 
-    for( auto n : lnrs ) std::cout << n << " "s;
+    //  consumer drains from the front.
+    std::cout << "drain:"s;
+    while (!queue.empty()) {
+      std::cout << ' ' << queue.front();
+      queue.pop_front();
+    }
     std::cout << '\n';
 
-    auto fi = std::next( lnrs.begin() );
-    auto la = std::next( fi, 3 );
-
-    lnrs.erase_after( fi, la );
+    queue.push_back(42);
+    std::cout << "queue: "s << queue << " back: "s << queue.back() << '\n';
 
-    for( auto n : lnrs ) std::cout << n << " "s;
     std::cout << '\n';
+  }
+
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "cflc::tail_list - insert_after, erase_after"s << '\n';
+  {
+    using namespace cflc;
+
+    tail_list<std::string> words { "the"s, "frogurt"s, "is"s, "also"s, "cursed"s, };
+    std::cout << "words: "s << words << '\n';
+
+    words.insert_after(words.before_end(), "again"s);
+    std::cout << "words: "s << words << " back: "s << words.back() << '\n';
+
+    auto fi = std::next(words.begin(), 2);
+    words.erase_after(fi, words.end());
+    std::cout << "words: "s << words << " back: "s << words.back() << '\n';
+
+    words.push_back("strawberry"s);
+    std::cout << "words: "s << words << " back: "s << words.back() << '\n';
 
     std::cout << '\n';
   }
 
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - push_front"s << '\n';
+  std::cout << "cflc::tail_list - sort, merge, reverse, unique, remove, resize,"s
+            << " splice_after"s << '\n';
   {
-    auto prlist = [](auto ln) {
-      std::cout << ln << '\n';
-    };
+    using namespace cflc;
 
-    std::forward_list slist {
-      "O for a Muse of fire, that would ascend"s,
-      "The brightest heaven of invention,"s,
-      "A kingdom for a stage, princes to act"s,
-      "And monarchs to behold the swelling scene!"s,
+    //  each of these can move the last node; back() and push_back follow it.
+    auto show = [](std::string const & what, tail_list<int> const & lst) {
+      std::cout << std::left << std::setw(14) << what << std::right
+                << lst << " back: "s << lst.back() << '\n';
     };
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
-    std::cout << '\n';
 
-    auto toinsert = std::vector {
-      "The Life of King Henry the Fifth."s,
-      "Act I."s,
-      "Prolog.\n"s
-    };
+    tail_list<int> list1 { 5, 9, 0, 1, 3, };
+    tail_list<int> list2 { 8, 7, 2, 6, 4, };
+    list1.sort();
+    show("sort:"s, list1);
+    list2.sort(std::greater<>());
+    list2.reverse();
+    show("reverse:"s, list2);
+    list1.merge(list2);
+    show("merge:"s, list1);
+
+    list1.resize(12, 9);
+    show("resize(12):"s, list1);
+    std::cout << "unique: "s << list1.unique() << " removed\n"s;
+    show("unique:"s, list1);
+    list1.remove(9);
+    show("remove(9):"s, list1);
+    list1.resize(5);
+    show("resize(5):"s, list1);
+
+    tail_list<int> extra { 10, 11, 12, };
+    list1.splice_after(list1.before_end(), extra, extra.cbegin(), extra.cend());
+    show("splice_after:"s, list1);
+    list1.splice_after(list1.cbefore_begin(), list1, std::next(list1.cbegin(), 4));
+    show("splice_after:"s, list1);
+    list1.push_back(99);
+    show("push_back:"s, list1);
 
-    std::for_each(toinsert.crbegin(), toinsert.crend(), [&](auto ln) {
-      slist.push_front(ln);
-    });
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
-    std::cout << '\n';
+    std::cout << std::boolalpha;
+    std::cout << "extra: "s << extra << " < list1 returns "s << (extra < list1) << '\n';
+    std::cout << std::noboolalpha;
 
     std::cout << '\n';
   }
 
+  std::cout << std::endl; //  make sure cout is flushed.
+
+  return 0;
+}
+
+
+//  MARK: - C_forward_list_work_stealing
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list_work_stealing()
+ */
+auto C_forward_list_work_stealing(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - emplace_front"s << '\n';
+  std::cout << "cflc::work_queue - steal_from"s << '\n';
   {
-    auto prlist = [](auto ln) {
-      std::cout << ln << '\n';
-    };
+    cflc::work_queue<int> victim;
+    cflc::work_queue<int> thief;
 
-    std::forward_list slist {
-      "O for a Muse of fire, that would ascend"s,
-      "The brightest heaven of invention,"s,
-      "A kingdom for a stage, princes to act"s,
-      "And monarchs to behold the swelling scene!"s,
+    for (int ix { 10 }; ix > 0; --ix) {
+      victim.push(ix);
+    }
+    std::cout << "victim: "s << victim.size() << " thief: "s << thief.size() << '\n';
+
+    auto stolen = thief.steal_from(victim);
+    std::cout << "stolen: "s << stolen
+              << " victim: "s << victim.size() << " thief: "s << thief.size() << '\n';
+
+    auto drain = [](std::string_view name, cflc::work_queue<int> & queue) {
+      std::cout << name;
+      while (auto task = queue.pop()) {
+        std::cout << ' ' << *task;
+      }
+      std::cout << '\n';
     };
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
+    drain("victim:"s, victim);
+    drain("thief: "s, thief);
+
     std::cout << '\n';
+  }
 
-    auto toinsert = std::vector {
-      "The Life of King Henry the Fifth."s,
-      "Act I."s,
-      "Prolog.\n"s
-    };
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "cflc::parallel_for_each"s << '\n';
+  {
+    std::forward_list<long> nums(100'000);
+    std::iota(nums.begin(), nums.end(), 1L);
 
-    std::for_each(toinsert.crbegin(), toinsert.crend(), [&](auto ln) {
-      slist.emplace_front(ln);
+    cflc::parallel_for_each(nums, [](long & nr) { nr *= nr; }, 4, 1'000);
+
+    auto expect = std::forward_list<long>(100'000);
+    std::iota(expect.begin(), expect.end(), 1L);
+    std::for_each(expect.begin(), expect.end(), [](long & nr) { nr *= nr; });
+
+    std::cout << std::boolalpha;
+    std::cout << "squares match serial for_each: "s << (nums == expect) << '\n';
+    std::cout << std::noboolalpha;
+
+    std::atomic<long> total { 0 };
+    cflc::parallel_for_each(std::as_const(nums), [&](long const & nr) {
+      total.fetch_add(nr % 7, std::memory_order_relaxed);
     });
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
-    std::cout << '\n';
+    std::cout << "sum of squares mod 7: "s << total.load()
+              << " (serial: "s
+              << std::accumulate(nums.begin(), nums.end(), 0L,
+                                 [](long acc, long nr) { return acc + nr % 7; })
+              << ")\n"s;
 
     std::cout << '\n';
   }
 
+  std::cout << std::endl; //  make sure cout is flushed.
+
+  return 0;
+}
+
+
+//  MARK: - C_forward_list_parallel_erase
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list_parallel_erase()
+ */
+auto C_forward_list_parallel_erase(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - pop_front"s << '\n';
+  std::cout << "cflc::parallel_remove_if, cflc::parallel_erase_if"s << '\n';
   {
-    auto prlist = [](auto ln) {
-      std::cout << ln << '\n';
-    };
+    using namespace cflc;
 
-    std::forward_list slist {
-      "The Life of King Henry the Fifth."s,
-      "Act I."s,
-      "Prolog.\n"s,
-      "O for a Muse of fire, that would ascend"s,
-      "The brightest heaven of invention,"s,
-      "A kingdom for a stage, princes to act"s,
-      "And monarchs to behold the swelling scene!"s,
-    };
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
-    std::cout << '\n';
+    std::forward_list<int> lst = { 1, 100, 2, 3, 10, 1, 11, -1, 12, };
+    std::cout << lst << '\n';
 
-    for (auto ix(0u); ix < 3u; ++ix) {
-      slist.pop_front();
-    }
+    //  min_segment 2 so even this short list is split across threads.
+    auto erased = parallel_remove_if(lst, [](int nr){ return nr > 10; }, 4, 2);
+    std::cout << lst << " erased: "s << erased << '\n';
 
-    std::for_each(slist.cbegin(), slist.cend(), prlist);
-    std::cout << '\n';
+    std::forward_list<char> cnt(10);
+    std::iota(cnt.begin(), cnt.end(), '0');
+    erased = parallel_erase_if(cnt, [](char x) { return (x - '0') % 2 == 0; }, 3, 2);
+    std::cout << cnt << " erased: "s << erased << '\n';
 
     std::cout << '\n';
   }
 
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - resize"s << '\n';
+  std::cout << "cflc::parallel_remove_if - large list"s << '\n';
   {
-    auto pc = [](auto el) {
-      std::cout << el << ' ';
-    };
-
-    std::forward_list<int> container = { 1, 2, 3, };
-    std::cout << "The forward_list holds: "s;
-    std::for_each(container.cbegin(), container.cend(), pc);
-    std::cout << '\n';
+    std::forward_list<int> par(200'000);
+    std::iota(par.begin(), par.end(), 0);
+    auto ser = par;
 
-    container.resize(5);
-    std::cout << "After resize up to 5: "s;
-    std::for_each(container.cbegin(), container.cend(), pc);
-    std::cout << '\n';
+    auto pred = [](int nr) { return nr % 3 == 0 || nr % 5 == 0; };
+    std::size_t ser_erased { 0 };
+    ser.remove_if([&](int nr) { return pred(nr) ? (++ser_erased, true) : false; });
+    auto par_erased = cflc::parallel_remove_if(par, pred, 4);
 
-    container.resize(2);
-    std::cout << "After resize down to 2: "s;
-    std::for_each(container.cbegin(), container.cend(), pc);
-    std::cout << '\n';
+    std::cout << std::boolalpha;
+    std::cout << "erased: "s << par_erased << " (serial: "s << ser_erased << ")"s
+              << " lists match: "s << (par == ser) << '\n';
+
+    auto bat = std::forward_list<int>(200'000);
+    std::iota(bat.begin(), bat.end(), 0);
+    auto bat_erased = cflc::parallel_remove_if_batched(bat,
+      [](std::span<int const> values, std::span<unsigned char> remove) {
+        for (std::size_t ix { 0 }; ix < values.size(); ++ix) {
+          remove[ix] = (values[ix] % 3 == 0) | (values[ix] % 5 == 0);
+        }
+      }, 4);
+    std::cout << "batched erased: "s << bat_erased
+              << " lists match: "s << (bat == ser) << '\n';
+    std::cout << std::noboolalpha;
 
     std::cout << '\n';
   }
 
+  std::cout << std::endl; //  make sure cout is flushed.
+
+  return 0;
+}
+
+
+//  MARK: - C_forward_list_indexed_list
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list_indexed_list()
+ */
+auto C_forward_list_indexed_list(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - swap"s << '\n';
+  std::cout << "cflc::indexed_list - nth, erase"s << '\n';
   {
     using namespace cflc;
 
-    std::forward_list<int> a1 { 1, 2, 3, }, a2 { 4, 5, };
-
-    auto it1 = std::next(a1.begin());
-    auto it2 = std::next(a2.begin());
-
-    int & ref1 = a1.front();
-    int & ref2 = a2.front();
+    //  the erase_after example, by position.
+    indexed_list<int> lnrs { 1, 2, 3, 4, 5, 6, 7, 8, 9, };
 
-    std::cout << a1 << a2 << *it1 << ' ' << *it2 << ' ' << ref1 << ' ' << ref2 << '\n';
-    a1.swap(a2);
-    std::cout << a1 << a2 << *it1 << ' ' << *it2 << ' ' << ref1 << ' ' << ref2 << '\n';
+    lnrs.erase(0); // Removes first element
+    std::cout << lnrs << '\n';
 
-    // Note that after swap the iterators and references stay associated with their
-    // original elements, e.g. it1 that pointed to an element in 'a1' with value 2
-    // still points to the same element, though this element was moved into 'a2'.
+    std::cout << "nth(1): "s << *lnrs.nth(1) << " nth(4): "s << *lnrs.nth(4) << '\n';
+    lnrs.erase(2, 2); // erase_after(nth(1), nth(4))
+    std::cout << lnrs << '\n';
 
     std::cout << '\n';
   }
 
-  /// Operations
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - merge"s << '\n';
+  std::cout << "cflc::indexed_list - insert, splice, lower_bound"s << '\n';
   {
     using namespace cflc;
 
-    std::forward_list<int> list1 = { 5, 9, 0, 1, 3, };
-    std::forward_list<int> list2 = { 8, 7, 2, 6, 4, };
+    indexed_list<int> sorted;
+    for (int nr : { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, }) {
+      sorted.insert_sorted(nr * 10);
+    }
+    std::cout << "sorted:      "s << sorted << '\n';
 
-    list1.sort();
-    list2.sort();
-    std::cout << "list1:  "s << list1 << '\n';
-    std::cout << "list2:  "s << list2 << '\n';
-    list1.merge(list2);
-    std::cout << "merged: "s << list1 << '\n';
+    sorted.splice(5, std::forward_list<int> { 41, 42, 43, });
+    std::cout << "splice(5):   "s << sorted << '\n';
+
+    for (int key : { -1, 42, 44, 90, 91, }) {
+      auto [ix, it] = sorted.lower_bound(key);
+      std::cout << "lower_bound("s << key << "): index "s << ix;
+      if (it != sorted.end()) {
+        std::cout << " value "s << *it;
+      }
+      std::cout << '\n';
+    }
 
     std::cout << '\n';
   }
 
-  /// Operations
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - splice_after"s << '\n';
+  std::cout << "cflc::indexed_list - large sorted list"s << '\n';
   {
-    using namespace cflc;
-
-    std::forward_list<int> l1 = { 1, 2, 3, 4, 5, };
-    std::forward_list<int> l2 = { 10, 11, 12, };
+    std::forward_list<long> evens(100'000);
+    std::generate(evens.begin(), evens.end(), [nr = 0L]() mutable { return nr += 2; });
+    cflc::indexed_list<long> idx(evens.begin(), evens.end());
 
-    std::cout << l1 << '\n';
-    std::cout << l2 << '\n';
+    std::cout << "nth(0): "s << *idx.nth(0)
+              << " nth(54'321): "s << *idx.nth(54'321)
+              << " nth(99'999): "s << *idx.nth(99'999) << '\n';
 
-    l2.splice_after(l2.cbegin(), l1, l1.cbegin(), l1.cend());
-    // not equivalent to l2.splice_after(l2.cbegin(), l1);
+    auto [ix, it] = idx.lower_bound(123'457L);
+    std::cout << "lower_bound(123'457): index "s << ix << " value "s << *it << '\n';
 
-    std::cout << l1 << '\n';
-    std::cout << l2 << '\n';
+    idx.erase(1'000, 50'000);
+    std::cout << "after erase(1'000, 50'000): size "s << idx.size()
+              << " nth(1'000): "s << *idx.nth(1'000) << '\n';
 
     std::cout << '\n';
   }
 
+  std::cout << std::endl; //  make sure cout is flushed.
+
+  return 0;
+}
+
+
+//  MARK: - C_forward_list_external_sort
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list_external_sort()
+ */
+auto C_forward_list_external_sort(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - remove, remove_if"s << '\n';
+  std::cout << "cflc::external_sorter - merge"s << '\n';
   {
     using namespace cflc;
 
-    std::forward_list<int> lst = { 1, 100, 2, 3, 10, 1, 11, -1, 12, };
-    std::cout << lst << '\n';
-
-    lst.remove(1); // remove both elements equal to 1
-    std::cout << lst << '\n';
+    std::forward_list<int> list1 = { 5, 9, 0, 1, 3, };
+    std::forward_list<int> list2 = { 8, 7, 2, 6, 4, };
 
-    lst.remove_if([](int nr){ return nr > 10; }); // remove all elements greater than 10
-    std::cout << lst << '\n';
+    //  a tiny budget spills the ten values to disk as two sorted blocks; the
+    //  fan-in is then 2, so the second spill fills level 0 and the pair is
+    //  merged into one run before merge_to_list() starts.
+    external_sorter<int> sorter(64);
+    sorter.push(std::move(list1));
+    sorter.push(std::move(list2));
+    std::cout << "spills: "s << sorter.spills() << " runs: "s << sorter.runs()
+              << " fan-in: "s << sorter.fan_in() << '\n';
+    std::cout << "merged: "s << sorter.merge_to_list() << '\n';
 
-//    for (int n_ : lst) {
-//      std::cout << n_ << ' ';
-//    }
-//    std::cout << '\n';
+    external_sorter<int, std::greater<int>> descending(64);
+    descending.push({ 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, });
+    std::cout << "descending: "s << descending.merge_to_list() << '\n';
 
     std::cout << '\n';
   }
 
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - reverse"s << '\n';
+  std::cout << "cflc::external_sorter - large input, small budget"s << '\n';
   {
-    using namespace cflc;
-
-    std::forward_list<int> list = { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
-
-    std::cout << "before:     "s << list << '\n';
+    std::minstd_rand rng { 2'021u };
+    std::forward_list<std::uint32_t> data;
+    for (int ix { 0 }; ix < 200'000; ++ix) {
+      data.push_front(static_cast<std::uint32_t>(rng()));
+    }
+    auto expect = data;
+    expect.sort();
 
-    list.sort();
-    std::cout << "ascending:  "s << list << '\n';
+    cflc::external_sorter<std::uint32_t> sorter(256 * 1'024);
+    sorter.push(data.begin(), data.end());
+    auto const spills = sorter.spills();
+    auto const runs = sorter.runs();
+    auto sorted = sorter.merge_to_list();
 
-    list.reverse();
-    std::cout << "descending: "s << list << '\n';
+    std::cout << std::boolalpha;
+    std::cout << "elements: 200000 spills: "s << spills << " runs: "s << runs
+              << " matches forward_list::sort: "s << (sorted == expect) << '\n';
+    std::cout << std::noboolalpha;
 
     std::cout << '\n';
   }
 
+  std::cout << std::endl; //  make sure cout is flushed.
+
+  return 0;
+}
+
+
+//  MARK: - C_forward_list_static_list
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list_static_list()
+ */
+auto C_forward_list_static_list(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - unique"s << '\n';
+  std::cout << "cflc::static_list - constexpr construction"s << '\n';
   {
     using namespace cflc;
 
-    std::forward_list<int> l_nr = { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
-
-    std::cout << "contents before:         " << l_nr << '\n';
-//    for (auto val : l_nr)
-//      std::cout << ' ' << val;
-//    std::cout << '\n';
+    //  built at compile time, stored in read-only data.
+    static constexpr static_list<int, 5> nums { 1, 2, 4, 8, 16, };
+    static_assert(nums.size() == 5);
+    static_assert(std::accumulate(nums.begin(), nums.end(), 0) == 31);
 
-    l_nr.unique();
-    std::cout << "contents after unique(): " << l_nr << '\n';
-//    for (auto val : l_nr)
-//      std::cout << ' ' << val;
-    std::cout << '\n';
+    std::cout << "nums: "s << nums << '\n';
+    std::cout << "Sum of nums: "s << std::accumulate(nums.begin(), nums.end(), 0) << '\n';
 
     std::cout << '\n';
   }
 
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - sort"s << '\n';
+  std::cout << "cflc::static_list - constexpr sort, reverse, unique, merge, splice_after"s << '\n';
   {
     using namespace cflc;
 
-    std::forward_list<int> list = { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
-
-    std::cout << "before:     "s << list << '\n';
-
-    list.sort();
-    std::cout << "ascending:  "s << list << '\n';
-
-    list.sort(std::greater<int>());
-    std::cout << "descending: "s << list << '\n';
+    static constexpr auto ascending = [] {
+      static_list<int, 10> list { 8, 7, 5, 9, 0, 1, 3, 2, 6, 4, };
+      list.sort();
+      return list;
+    }();
+    static_assert(ascending == static_list<int, 10> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, });
+
+    static constexpr auto descending = [] {
+      auto list = ascending;
+      list.reverse();
+      return list;
+    }();
+    static_assert(descending.front() == 9);
+
+    static constexpr auto uniq = [] {
+      static_list<int, 9> l_nr { 1, 2, 2, 3, 3, 2, 1, 1, 2, };
+      l_nr.unique();
+      return l_nr;
+    }();
+    static_assert(uniq.size() == 6);
+
+    static constexpr auto merged = [] {
+      static_list<int, 10> list1 { 5, 9, 0, 1, 3, };
+      static_list<int, 5> list2 { 8, 7, 2, 6, 4, };
+      list1.sort();
+      list2.sort(std::less<>());
+      list1.merge(list2);
+      return list1;
+    }();
+    static_assert(merged == ascending);
+
+    //  the splice_after example, l1's elements spliced into l2.
+    static constexpr auto spliced = [] {
+      static_list<int, 5> l1 { 1, 2, 3, 4, 5, };
+      static_list<int, 8> l2 { 10, 11, 12, };
+      l2.splice_after(l2.cbegin(), l1, l1.cbegin(), l1.cend());
+      return l2;
+    }();
+    static_assert(spliced == static_list<int, 7> { 10, 2, 3, 4, 5, 11, 12, });
+
+    //  a single element, from a list of another capacity.
+    static constexpr auto single = [] {
+      static_list<int, 5> l1 { 1, 2, 3, };
+      static_list<int, 8> l2 { 10, 11, 12, };
+      l2.splice_after(l2.cbegin(), l1, l1.cbegin());
+      return l2;
+    }();
+    static_assert(single == static_list<int, 4> { 10, 2, 11, 12, });
+
+    //  within one list, splice_after only relinks.
+    static constexpr auto rotated = [] {
+      static_list<int, 5> list { 1, 2, 3, 4, 5, };
+      list.splice_after(std::next(list.cbegin(), 4), list,
+                        list.cbefore_begin(), std::next(list.cbegin(), 2));
+      return list;
+    }();
+    static_assert(rotated == static_list<int, 5> { 3, 4, 5, 1, 2, });
+
+    std::cout << "ascending:  "s << ascending << '\n';
+    std::cout << "descending: "s << descending << '\n';
+    std::cout << "unique:     "s << uniq << '\n';
+    std::cout << "merged:     "s << merged << '\n';
+    std::cout << "spliced:    "s << spliced << '\n';
+    std::cout << "single:     "s << single << '\n';
+    std::cout << "rotated:    "s << rotated << '\n';
 
     std::cout << '\n';
   }
 
-  /// Non-member functions
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - std::operator==, etc."s << '\n';
+  std::cout << "cflc::static_list - operator==, operator<=>"s << '\n';
   {
     using namespace cflc;
 
-    std::forward_list<int> alice{ 1, 2, 3, };
-    std::forward_list<int> bob{ 7, 8, 9, 10, };
-    std::forward_list<int> eve{ 1, 2, 3, };
+    static constexpr static_list<int, 3> alice { 1, 2, 3, };
+    static constexpr static_list<int, 4> bob { 7, 8, 9, 10, };
+    static constexpr static_list<int, 3> eve { 1, 2, 3, };
 
-    std::cout << std::boolalpha;
+    static_assert(alice != bob && alice < bob);
+    static_assert(alice == eve && std::is_eq(alice <=> eve));
 
-    // Compare non equal containers
+    std::cout << std::boolalpha;
     std::cout << "alice == bob returns "s << (alice == bob) << '\n';
-    std::cout << "alice != bob returns "s << (alice != bob) << '\n';
     std::cout << "alice <  bob returns "s << (alice < bob) << '\n';
-    std::cout << "alice <= bob returns "s << (alice <= bob) << '\n';
-    std::cout << "alice >  bob returns "s << (alice > bob) << '\n';
-    std::cout << "alice >= bob returns "s << (alice >= bob) << '\n';
+    std::cout << "alice == eve returns "s << (alice == eve) << '\n';
+    std::cout << "alice <= eve returns "s << (alice <= eve) << '\n';
+    std::cout << std::noboolalpha;
 
     std::cout << '\n';
+  }
 
-    // Compare equal containers
-    std::cout << "alice == eve returns " << (alice == eve) << '\n';
-    std::cout << "alice != eve returns " << (alice != eve) << '\n';
-    std::cout << "alice <  eve returns " << (alice < eve) << '\n';
-    std::cout << "alice <= eve returns " << (alice <= eve) << '\n';
-    std::cout << "alice >  eve returns " << (alice > eve) << '\n';
-    std::cout << "alice >= eve returns " << (alice >= eve) << '\n';
+  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  std::cout << konst::dot << '\n';
+  std::cout << "cflc::static_list - runtime insert_after, erase_after"s << '\n';
+  {
+    using namespace cflc;
 
-    std::cout << '\n';
+    static_list<int, 9> lnrs { 1, 2, 3, 4, 5, 6, 7, 8, 9, };
 
-#if (__cplusplus > 201707L)
-    //  TODO:  add spaceship operator tests
-    auto eq = std::is_eq  (alice <=> eve);
-    auto ne = std::is_neq (alice <=> eve);
-    auto lt = std::is_lt  (alice <=> eve);
-    auto le = std::is_lteq(alice <=> eve);
-    auto gt = std::is_gt  (alice <=> eve);
-    auto ge = std::is_gteq(alice <=> eve);
-#endif  /* (__cplusplus > 201707L) */
+    lnrs.erase_after(lnrs.before_begin()); // Removes first element
+    std::cout << lnrs << '\n';
 
-    std::cout << std::boolalpha;
+    auto fi = std::next(lnrs.begin());
+    auto la = std::next(fi, 3);
+    lnrs.erase_after(fi, la);
+    std::cout << lnrs << '\n';
+
+    lnrs.insert_after(lnrs.begin(), 42);
+    std::cout << lnrs << " size: "s << lnrs.size()
+              << " max_size: "s << lnrs.max_size() << '\n';
+
+    try {
+      while (true) {
+        lnrs.push_front(0);
+      }
+    }
+    catch (std::length_error const & ex) {
+      std::cout << ex.what() << '\n';
+    }
 
     std::cout << '\n';
   }
 
-  /// Non-member functions
+  std::cout << std::endl; //  make sure cout is flushed.
+
+  return 0;
+}
+
+
+//  MARK: - C_forward_list_batch_publish
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+//  ================================================================================
+//  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
+/*
+ *  MARK: C_forward_list_batch_publish()
+ */
+auto C_forward_list_batch_publish(int argc, const char * argv[]) -> decltype(argc) {
+  std::cout << "In "s << __func__ << std::endl;
+
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - std::swap"s << '\n';
+  std::cout << "cflc::shared_batch_list - publish, detach"s << '\n';
   {
-    using namespace cflc;
+    using shared_type = cflc::shared_batch_list<std::string>;
 
-    std::forward_list<int> alice { 1, 2, 3, };
-    std::forward_list<int> bob   { 7, 8, 9, 10, };
+    shared_type shared;
 
-    // Print state before swap
-    std::cout << "before [alice]: "s << alice << '\n';
-    std::cout << "       [bob]  : "s << bob << '\n';
+    auto toinsert = std::vector {
+      "The Life of King Henry the Fifth."s,
+      "Act I."s,
+      "Prolog."s
+    };
 
-    std::cout << "-- SWAP\n";
-    std::swap(alice, bob);
+    shared_type::batch prolog;
+    std::for_each(toinsert.crbegin(), toinsert.crend(), [&](auto ln) {
+      prolog.push_front(ln);
+    });
 
-    // Print state after swap
-    std::cout << "after  [alice]: "s << alice << '\n';
-    std::cout << "       [bob]  : "s << bob << '\n';
+    shared_type::batch verse(std::forward_list {
+      "O for a Muse of fire, that would ascend"s,
+      "The brightest heaven of invention,"s,
+    });
+
+    shared.publish(std::move(verse));
+    shared.publish(std::move(prolog));
+
+    //  newest batch first.
+    auto lines = shared.detach();
+    std::for_each(lines.begin(), lines.end(), [](auto const & ln) {
+      std::cout << ln << '\n';
+    });
+    std::cout << std::boolalpha;
+    std::cout << "shared.empty(): "s << shared.empty() << '\n';
+    std::cout << std::noboolalpha;
 
     std::cout << '\n';
   }
 
-  /// Non-member functions
   // ....+....!....+....!....+....!....+....!....+....!....+....!
   std::cout << konst::dot << '\n';
-  std::cout << "std::C_forward_list - std::erase, std::erase_if"s << '\n';
+  std::cout << "cflc::shared_batch_list - benchmark vs locked push_front"s << '\n';
   {
-    auto print_container = [](std::string_view comment,
-                              std::forward_list<char> const & chars) {
-      std::cout << comment;
-      for (auto cx : chars) {
-        std::cout << cx << ' ';
-      }
-      std::cout << '\n';
+    constexpr int producers  { 4 };
+    constexpr int batches    { 200 };
+    constexpr int batch_size { 1'000 };
+    constexpr long expect    { long { producers } * batches * batch_size };
+
+    using clock = std::chrono::steady_clock;
+    auto elapsed_ms = [](clock::time_point start) {
+      return std::chrono::duration<double, std::milli>(clock::now() - start).count();
     };
 
-    std::forward_list<char> cnt(10);
-    std::iota(cnt.begin(), cnt.end(), '0');
-    print_container("Init:\n"s, cnt);
+    //  Both sides run the same shape: producers plus one consumer that takes
+    //  everything published so far, keeps each non-empty take (so no node is
+    //  freed inside the timing) and sleeps briefly when there was nothing.
+    auto bench = [&](auto produce, auto take) {
+      std::vector<decltype(take())> kept;
+      std::atomic<int> running { producers };
+      long count { 0 };
+
+      auto start = clock::now();
+      std::vector<std::thread> threads;
+      for (int px { 0 }; px < producers; ++px) {
+        threads.emplace_back([&, px] {
+          produce(px);
+          --running;
+        });
+      }
+      std::thread consumer([&] {
+        for (;;) {
+          bool const last_pass = running.load() == 0;
+          auto items = take();
+          if (items.empty()) {
+            if (last_pass) {
+              break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            continue;
+          }
+          count += std::distance(items.begin(), items.end());
+          kept.push_back(std::move(items));
+        }
+      });
+      for (auto & thr : threads) {
+        thr.join();
+      }
+      consumer.join();
 
-    std::erase(cnt, '3');
-    print_container("Erase '3':\n"s, cnt);
+      return std::make_pair(elapsed_ms(start), count);
+    };
 
-#if (__cplusplus > 201707L)
-  //`TODO:  add C++20 feature tests
-    auto erased = std::erase_if(cnt, [](char x) { return (x - '0') % 2 == 0; });
-    print_container("Erase all even numbers:\n"s, cnt);
-    std::cout << "In all " << erased << " even numbers were erased.\n"s;
-#endif  /* (__cplusplus > 201707L) */
+    //  per-element: one lock and one push_front per element.
+    std::forward_list<int> locked_list;
+    std::mutex mtx;
+    auto [locked_ms, locked_count] = bench(
+      [&](int px) {
+        for (int bx { 0 }; bx < batches; ++bx) {
+          for (int ex { 0 }; ex < batch_size; ++ex) {
+            std::lock_guard<std::mutex> lock(mtx);
+            locked_list.push_front(px * batch_size + ex);
+          }
+        }
+      },
+      [&] {
+        std::forward_list<int> items;
+        std::lock_guard<std::mutex> lock(mtx);
+        items.swap(locked_list);
+        return items;
+      });
+
+    //  per-batch: build locally, one CAS per batch, one exchange per take.
+    cflc::shared_batch_list<int> shared;
+    auto [batch_ms, batch_count] = bench(
+      [&](int px) {
+        for (int bx { 0 }; bx < batches; ++bx) {
+          cflc::shared_batch_list<int>::batch local;
+          for (int ex { 0 }; ex < batch_size; ++ex) {
+            local.push_front(px * batch_size + ex);
+          }
+          shared.publish(std::move(local));
+        }
+      },
+      [&] { return shared.detach(); });
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "elements:               "s << expect << '\n';
+    std::cout << "locked push_front:      "s << std::setw(8) << locked_ms << " ms"s
+              << " (count "s << locked_count << ")\n"s;
+    std::cout << "batch publish + detach: "s << std::setw(8) << batch_ms << " ms"s
+              << " (count "s << batch_count << ")\n"s;
+    std::cout << std::defaultfloat << std::setprecision(6);
 
     std::cout << '\n';
   }
@@ -781,46 +4090,557 @@ auto C_forward_list(int argc, const char * argv[]) -> decltype(argc) {
   return 0;
 }
 
-//  MARK: - C_forward_list
+
+//  MARK: - C_forward_list_regression
 //  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
 //  ================================================================================
 //  ....+....!....+....!....+....!....+....!....+....!....+....!....+....!....+....!
 /*
- *  MARK: C_forward_list()
+ *  MARK: C_forward_list_regression()
+ *  Runs the C_forward_list() operations on fixed seeds through the cflc
+ *  containers and algorithms, checks each result against a std::forward_list
+ *  or std::vector reference (compared as cflc::operator<< output) and times
+ *  the cflc side, or std::forward_list itself where cflc has no counterpart.
+ *  Timings are compared against the baseline file; a missing baseline fails
+ *  unless --update-baseline is given, which (re)writes it when every case
+ *  matched.
+ *  Returns non-zero on a mismatch, a regression or a missing baseline.
  */
-auto C_forward_list_deduction_guides(int argc, const char * argv[]) -> decltype(argc) {
+auto C_forward_list_regression(int argc, const char * argv[]) -> decltype(argc) {
+  using namespace cflc;
+  using regress::outputs;
+  using regress::print;
+  using regress::stopwatch;
+
   std::cout << "In "s << __func__ << std::endl;
 
-  /// Member functions
-  // ....+....!....+....!....+....!....+....!....+....!....+....!
+  regress::options opts;
+  try {
+    opts = regress::parse(argc, argv);
+  }
+  catch (std::invalid_argument const & ex) {
+    std::cerr << ex.what() << '\n' << regress::usage();
+    return 2;
+  }
+  auto const nr = opts.scale;
+
+  //  fixed seeds: every run sees the same data.
+  auto wide = [nr](unsigned seed) {
+    std::minstd_rand rng { seed };
+    std::vector<int> values(nr);
+    std::generate(values.begin(), values.end(),
+                  [&] { return static_cast<int>(rng() % 1'000'000); });
+    return values;
+  };
+  auto narrow = [nr](unsigned seed) {
+    std::minstd_rand rng { seed };
+    std::vector<int> values(nr);
+    std::generate(values.begin(), values.end(),
+                  [&] { return static_cast<int>(rng() % 4); });
+    return values;
+  };
+  auto positions = [](unsigned seed, std::size_t count, std::size_t bound) {
+    std::minstd_rand rng { seed };
+    std::vector<std::size_t> pos(count);
+    for (auto & px : pos) {
+      px = rng() % bound;
+    }
+    return pos;
+  };
+
+  std::vector<std::pair<std::string, std::function<outputs(stopwatch &)>>> cases;
+
+  //  constructor, push_front, pop_front, emplace_after-built (push_back), splice_after
+  cases.emplace_back("constructor"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(11u);
+    std::optional<tail_list<int>> cand;
+    { auto lap = sw.time(); cand.emplace(values.begin(), values.end()); }
+    return { print(*cand), print(std::forward_list<int>(values.begin(), values.end())) };
+  });
+
+  cases.emplace_back("push_front"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(12u);
+    tail_list<int> cand;
+    { auto lap = sw.time(); for (auto vx : values) { cand.push_front(vx); } }
+    std::forward_list<int> ref;
+    for (auto vx : values) { ref.push_front(vx); }
+    return { print(cand), print(ref) };
+  });
+
+  cases.emplace_back("pop_front"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(13u);
+    tail_list<int> cand(values.begin(), values.end());
+    std::forward_list<int> ref(values.begin(), values.end());
+    {
+      auto lap = sw.time();
+      for (std::size_t ix { 0 }; ix < nr / 2; ++ix) { cand.pop_front(); }
+    }
+    for (std::size_t ix { 0 }; ix < nr / 2; ++ix) { ref.pop_front(); }
+    return { print(cand), print(ref) };
+  });
+
+  cases.emplace_back("emplace_back"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(14u);
+    tail_list<int> cand;
+    { auto lap = sw.time(); for (auto vx : values) { cand.emplace_back(vx); } }
+    std::forward_list<int> ref;
+    auto iter = ref.before_begin();
+    for (auto vx : values) { iter = ref.emplace_after(iter, vx); }
+    return { print(cand), print(ref) };
+  });
+
+  //  short batches under one lap, so the O(1) splices outweigh the clock.
+  cases.emplace_back("splice_after"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(15u);
+    auto const batch = std::size_t { 4 };
+    std::vector<tail_list<int>> cbats;
+    std::forward_list<int> ref;
+    auto rend = ref.before_begin();
+    for (std::size_t first { 0 }; first < nr; first += batch) {
+      auto last = std::min(first + batch, nr);
+      cbats.emplace_back(values.begin() + first, values.begin() + last);
+      std::forward_list<int> rbat(values.begin() + first, values.begin() + last);
+      auto const count = std::distance(rbat.begin(), rbat.end());
+      ref.splice_after(rend, rbat);
+      std::advance(rend, count);
+    }
+    tail_list<int> cand;
+    { auto lap = sw.time(); for (auto & cbat : cbats) { cand.splice_back(cbat); } }
+    return { print(cand), print(ref) };
+  });
+
+  //  insert_after / erase_after at positions
+  cases.emplace_back("insert_after"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(16u);
+    auto pos = positions(17u, 1'000, nr);
+    indexed_list<int> cand(values.begin(), values.end());
+    std::forward_list<int> ref(values.begin(), values.end());
+    { auto lap = sw.time(); for (auto px : pos) { cand.insert(px, -1); } }
+    for (auto px : pos) { ref.insert_after(std::next(ref.before_begin(), px), -1); }
+    return { print(cand), print(ref) };
+  });
+
+  cases.emplace_back("erase_after"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(18u);
+    //  at most 3 * nr / 8 values go, so every position below nr / 2 stays in range.
+    auto pos = positions(19u, std::min<std::size_t>(1'000, nr / 8), nr / 2);
+    indexed_list<int> cand(values.begin(), values.end());
+    std::forward_list<int> ref(values.begin(), values.end());
+    { auto lap = sw.time(); for (auto px : pos) { cand.erase(px, 3); } }
+    for (auto px : pos) {
+      auto fi = std::next(ref.before_begin(), px);
+      ref.erase_after(fi, std::next(fi, 4));
+    }
+    return { print(cand), print(ref) };
+  });
+
+  cases.emplace_back("nth"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(20u);
+    auto pos = positions(21u, 1'000, nr);
+    indexed_list<int> cand(values.begin(), values.end());
+    std::forward_list<int> ref(values.begin(), values.end());
+    std::forward_list<int> cout_, rout;
+    { auto lap = sw.time(); for (auto px : pos) { cout_.push_front(*cand.nth(px)); } }
+    for (auto px : pos) { rout.push_front(*std::next(ref.begin(), px)); }
+    return { print(cout_), print(rout) };
+  });
+
+  //  external_sorter: two sorted inputs, and one input spilled to runs
+  cases.emplace_back("external_merge"s, [&](stopwatch & sw) -> outputs {
+    auto values1 = wide(22u);
+    auto values2 = wide(23u);
+    std::forward_list<int> list1(values1.begin(), values1.end());
+    std::forward_list<int> list2(values2.begin(), values2.end());
+    list1.sort();
+    list2.sort();
+    std::forward_list<int> cand;
+    {
+      auto lap = sw.time();
+      external_sorter<int> sorter(nr * sizeof(int));
+      sorter.push(list1.begin(), list1.end());
+      sorter.push(list2.begin(), list2.end());
+      cand = sorter.merge_to_list();
+    }
+    list1.merge(list2);
+    return { print(cand), print(list1) };
+  });
+
+  cases.emplace_back("external_sort"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(24u);
+    std::forward_list<int> cand;
+    {
+      auto lap = sw.time();
+      external_sorter<int> sorter(nr * sizeof(int) / 4);
+      sorter.push(values.begin(), values.end());
+      cand = sorter.merge_to_list();
+    }
+    std::forward_list<int> ref(values.begin(), values.end());
+    ref.sort();
+    return { print(cand), print(ref) };
+  });
+
+  //  fixed-capacity list: sort, reverse, unique on each max_size() chunk of
+  //  the values, so the work follows --scale like the other cases.
+  using fixed_list = static_list<int, 4'096>;
+  auto per_chunk = [](std::vector<int> const & values, stopwatch & sw, auto op) -> outputs {
+    outputs out;
+    for (std::size_t first { 0 }; first < values.size(); first += fixed_list::max_size()) {
+      auto const last = std::min(first + fixed_list::max_size(), values.size());
+      auto cand = std::make_unique<fixed_list>(values.begin() + first, values.begin() + last);
+      std::forward_list<int> ref(values.begin() + first, values.begin() + last);
+      { auto lap = sw.time(); op(*cand); }
+      op(ref);
+      out.first += print(*cand);
+      out.second += print(ref);
+    }
+    return out;
+  };
+
+  cases.emplace_back("static_sort"s, [&](stopwatch & sw) -> outputs {
+    return per_chunk(wide(25u), sw, [](auto & list) { list.sort(); });
+  });
+
+  cases.emplace_back("static_reverse"s, [&](stopwatch & sw) -> outputs {
+    return per_chunk(wide(26u), sw, [](auto & list) { list.reverse(); });
+  });
+
+  cases.emplace_back("static_unique"s, [&](stopwatch & sw) -> outputs {
+    return per_chunk(narrow(27u), sw, [](auto & list) { list.unique(); });
+  });
+
+  //  remove_if, erase_if, for_each
+  cases.emplace_back("remove_if"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(28u);
+    auto pred = [](int vx) { return vx > 500'000; };
+    std::forward_list<int> cand(values.begin(), values.end());
+    std::forward_list<int> ref(values.begin(), values.end());
+    { auto lap = sw.time(); parallel_remove_if(cand, pred); }
+    ref.remove_if(pred);
+    return { print(cand), print(ref) };
+  });
+
+  cases.emplace_back("erase_if"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(29u);
+    auto pred = [](int vx) { return vx % 2 == 0; };
+    std::forward_list<int> cand(values.begin(), values.end());
+    std::forward_list<int> ref(values.begin(), values.end());
+    std::size_t cerased, rerased;
+    { auto lap = sw.time(); cerased = parallel_erase_if(cand, pred); }
+    rerased = std::erase_if(ref, pred);
+    return { print(cand) + std::to_string(cerased),
+             print(ref) + std::to_string(rerased) };
+  });
+
+  cases.emplace_back("for_each"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(30u);
+    auto fn = [](int & vx) { vx = vx / 3 + 7; };
+    std::forward_list<int> cand(values.begin(), values.end());
+    std::forward_list<int> ref(values.begin(), values.end());
+    { auto lap = sw.time(); parallel_for_each(cand, fn); }
+    std::for_each(ref.begin(), ref.end(), fn);
+    return { print(cand), print(ref) };
+  });
+
+  //  push_front of whole batches
+  cases.emplace_back("batch_publish"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(31u);
+    auto const batch = std::max<std::size_t>(nr / 100, 1);
+    shared_batch_list<int> shared;
+    std::forward_list<int> ref;
+    for (std::size_t first { 0 }; first < nr; first += batch) {
+      auto last = std::min(first + batch, nr);
+      shared_batch_list<int>::batch local;
+      {
+        auto lap = sw.time();
+        std::for_each(values.begin() + first, values.begin() + last,
+                      [&](int vx) { local.push_front(vx); });
+        shared.publish(std::move(local));
+      }
+      std::for_each(values.begin() + first, values.begin() + last,
+                    [&](int vx) { ref.push_front(vx); });
+    }
+    auto items = shared.detach();
+    return { print(std::forward_list<int>(items.begin(), items.end())), print(ref) };
+  });
+
+  //  the remaining C_forward_list() operations have no cflc counterpart, so
+  //  std::forward_list itself is timed; the references come from std::vector.
+  auto as_list = [](std::vector<int> const & values) {
+    return std::forward_list<int>(values.begin(), values.end());
+  };
+
+  cases.emplace_back("copy_assign"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(32u);
+    auto const src = as_list(values);
+    auto cand = as_list(wide(33u));
+    { auto lap = sw.time(); cand = src; }
+    return { print(cand), print(as_list(values)) };
+  });
+
+  cases.emplace_back("move_assign"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(34u);
+    auto src = as_list(values);
+    auto cand = as_list(wide(35u));
+    { auto lap = sw.time(); cand = std::move(src); }
+    return { print(cand), print(as_list(values)) };
+  });
+
+  cases.emplace_back("assign"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(36u);
+    auto cand = as_list(wide(37u));
+    {
+      auto lap = sw.time();
+      cand.assign(nr / 2, -1);
+      cand.assign(values.begin(), values.end());
+    }
+    return { print(cand), print(as_list(values)) };
+  });
+
+  cases.emplace_back("clear"s, [&](stopwatch & sw) -> outputs {
+    auto cand = as_list(wide(38u));
+    { auto lap = sw.time(); cand.clear(); }
+    return { print(cand) + std::to_string(cand.empty()),
+             print(std::forward_list<int>()) + "1"s };
+  });
+
+  cases.emplace_back("emplace_front"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(39u);
+    std::forward_list<int> cand;
+    { auto lap = sw.time(); for (auto vx : values) { cand.emplace_front(vx); } }
+    std::reverse(values.begin(), values.end());
+    return { print(cand), print(as_list(values)) };
+  });
+
+  cases.emplace_back("resize"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(40u);
+    auto cand = as_list(values);
+    {
+      auto lap = sw.time();
+      cand.resize(2 * nr, -1);
+      cand.resize(nr / 2);
+    }
+    values.resize(2 * nr, -1);
+    values.resize(nr / 2);
+    return { print(cand), print(as_list(values)) };
+  });
+
+  cases.emplace_back("swap"s, [&](stopwatch & sw) -> outputs {
+    auto values1 = wide(41u);
+    auto values2 = wide(42u);
+    auto cand1 = as_list(values1);
+    auto cand2 = as_list(values2);
+    {
+      auto lap = sw.time();
+      for (std::size_t ix { 0 }; ix < nr; ++ix) {
+        if (ix % 2 == 0) { cand1.swap(cand2); }
+        else { std::swap(cand1, cand2); }
+      }
+    }
+    if (nr % 2 != 0) { values1.swap(values2); }
+    return { print(cand1) + print(cand2),
+             print(as_list(values1)) + print(as_list(values2)) };
+  });
+
+  cases.emplace_back("merge"s, [&](stopwatch & sw) -> outputs {
+    auto values1 = wide(43u);
+    auto values2 = wide(44u);
+    std::sort(values1.begin(), values1.end());
+    std::sort(values2.begin(), values2.end());
+    auto cand1 = as_list(values1);
+    auto cand2 = as_list(values2);
+    { auto lap = sw.time(); cand1.merge(cand2); }
+    std::vector<int> ref;
+    std::merge(values1.begin(), values1.end(), values2.begin(), values2.end(),
+               std::back_inserter(ref));
+    return { print(cand1) + print(cand2),
+             print(as_list(ref)) + print(std::forward_list<int>()) };
+  });
+
+  cases.emplace_back("sort"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(45u);
+    auto cand = as_list(values);
+    { auto lap = sw.time(); cand.sort(); }
+    std::sort(values.begin(), values.end());
+    return { print(cand), print(as_list(values)) };
+  });
+
+  cases.emplace_back("reverse"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(46u);
+    auto cand = as_list(values);
+    { auto lap = sw.time(); cand.reverse(); }
+    std::reverse(values.begin(), values.end());
+    return { print(cand), print(as_list(values)) };
+  });
+
+  cases.emplace_back("unique"s, [&](stopwatch & sw) -> outputs {
+    auto values = narrow(47u);
+    auto cand = as_list(values);
+    std::size_t cremoved;
+    { auto lap = sw.time(); cremoved = cand.unique(); }
+    auto last = std::unique(values.begin(), values.end());
+    auto rremoved = static_cast<std::size_t>(std::distance(last, values.end()));
+    values.erase(last, values.end());
+    return { print(cand) + std::to_string(cremoved),
+             print(as_list(values)) + std::to_string(rremoved) };
+  });
+
+  cases.emplace_back("remove"s, [&](stopwatch & sw) -> outputs {
+    auto values = narrow(48u);
+    auto cand = as_list(values);
+    std::size_t cremoved;
+    { auto lap = sw.time(); cremoved = cand.remove(1); }
+    auto rremoved = std::erase(values, 1);
+    return { print(cand) + std::to_string(cremoved),
+             print(as_list(values)) + std::to_string(rremoved) };
+  });
+
+  cases.emplace_back("erase"s, [&](stopwatch & sw) -> outputs {
+    auto values = narrow(49u);
+    auto cand = as_list(values);
+    std::size_t cerased;
+    { auto lap = sw.time(); cerased = std::erase(cand, 2); }
+    auto rerased = std::erase(values, 2);
+    return { print(cand) + std::to_string(cerased),
+             print(as_list(values)) + std::to_string(rerased) };
+  });
+
+  //  ==, !=, <, <=, >, >= and <=> against an equal list and one that differs
+  //  only in its last element.
+  cases.emplace_back("compare"s, [&](stopwatch & sw) -> outputs {
+    auto values = wide(50u);
+    auto other = values;
+    other.back() += 1;
+    auto compare = [](auto const & lhs, auto const & rhs) {
+      auto const order = lhs <=> rhs;
+      return std::to_string(lhs == rhs) + std::to_string(lhs != rhs)
+           + std::to_string(lhs < rhs) + std::to_string(lhs <= rhs)
+           + std::to_string(lhs > rhs) + std::to_string(lhs >= rhs)
+           + std::to_string(order < 0) + std::to_string(order == 0);
+    };
+    auto cand1 = as_list(values);
+    auto cand2 = as_list(values);
+    auto cand3 = as_list(other);
+    std::string cres;
+    {
+      auto lap = sw.time();
+      cres = compare(cand1, cand2) + compare(cand1, cand3) + compare(cand3, cand1);
+    }
+    return { cres,
+             compare(values, values) + compare(values, other) + compare(other, values) };
+  });
+
+  //  run
+  regress::baseline_type current { nr, opts.sample_ms, {} };
+  bool failed { false };
+
   std::cout << konst::dot << '\n';
-  std::cout << "std::forward_list - deduction guides"s << '\n';
-  {
-    std::vector<int> vec = { 1, 2, 3, 4, };
+  std::cout << "scale: "s << nr << " repeat: "s << opts.repeat
+            << " sample: "s << opts.sample_ms << " ms"s
+            << " baseline: "s << opts.baseline
+            << " threshold: "s << opts.threshold << "%\n"s;
+
+  //  rounds run every case once, so each case's samples see the heap and
+  //  caches as left by different neighbours and its spread reflects that.
+  std::vector<std::vector<double>> samples(cases.size());
+  std::vector<char> matches(cases.size(), true);
+  for (std::size_t rx { 0 }; rx < opts.repeat; ++rx) {
+    for (std::size_t cx { 0 }; cx < cases.size(); ++cx) {
+      bool match { true };
+      samples[cx].push_back(regress::sample(cases[cx].second, opts.sample_ms, match));
+      matches[cx] = matches[cx] && match;
+    }
+  }
 
-    // uses explicit deduction guide to deduce std::forward_list<int>
-    std::forward_list xlst(vec.begin(), vec.end());
-    std::for_each(xlst.cbegin(), xlst.cend(), [](auto x_) {
-      std::cout << std::setw(4) << x_;
-    });
-    std::cout << '\n';
+  for (std::size_t cx { 0 }; cx < cases.size(); ++cx) {
+    auto const & name = cases[cx].first;
+    auto const tm = regress::summarise(std::move(samples[cx]));
+    current.timings.emplace_back(name, tm);
+    failed = failed || !matches[cx];
 
-    // deduces std::forward_list<std::vector<int>::iterator>
-    // first phase of overload resolution for list-initialization selects the candidate
-    // synthesized from the initializer-list constructor; second phase is not performed
-    // and deduction guide has no effect
-    std::forward_list ylst { vec.begin(), vec.end() };
-    auto i1 = ylst.front();
-    ylst.reverse();
-    auto i2 = ylst.front();
-    auto acc = std::accumulate(i1, i2, 0, std::plus<>());
-    std::cout << std::setw(4) << acc << '\n';
+    std::cout << std::left << std::setw(16) << name << std::right
+              << std::fixed << std::setprecision(3) << std::setw(12) << tm.ms << " ms"s
+              << " +/- "s << std::setw(8) << tm.spread
+              << (matches[cx] ? "  ok"s : "  MISMATCH"s) << '\n';
+  }
+  std::cout << std::defaultfloat << std::setprecision(6);
 
-    std::cout << '\n';
+  auto baseline = regress::load_baseline(opts.baseline);
+  if (opts.update) {
+    //  a baseline is only worth keeping if every case produced the right result.
+    if (failed) {
+      std::cout << "baseline not written: a case reported MISMATCH\n"s;
+    }
+    else {
+      regress::save_baseline(opts.baseline, current);
+      std::cout << "baseline written: "s << opts.baseline << '\n';
+    }
+  }
+  else if (!baseline) {
+    std::cout << "no baseline at "s << opts.baseline
+              << "; run with --update-baseline to create one\n"s;
+    failed = true;
+  }
+  else if (baseline->scale == 0) {
+    std::cout << "baseline "s << opts.baseline << " has no '# scale N sample MS' header;"s
+              << " rerun with --update-baseline\n"s;
+    failed = true;
   }
+  else if (!baseline->same_options(current)) {
+    std::cout << "baseline "s << opts.baseline
+              << " was recorded at scale: "s << baseline->scale << " sample: "s << baseline->sample_ms << " ms; rerun with those options"s
+              << " or with --update-baseline\n"s;
+    failed = true;
+  }
+  else {
+    auto const & recorded = baseline->timings;
+    std::vector<std::pair<regress::timing, regress::timing const *>> pairs;
+    std::vector<double> ratios;
+    for (auto const & [name, tm] : current.timings) {
+      auto matches_name = [&name = name](auto const & entry) { return entry.first == name; };
+      auto bx = std::find_if(recorded.begin(), recorded.end(), matches_name);
+      pairs.emplace_back(tm, bx == recorded.end() ? nullptr : &bx->second);
+      if (bx != recorded.end() && bx->second.ms > 0.0) {
+        ratios.push_back(tm.ms / bx->second.ms);
+      }
+    }
 
-  std::cout << std::endl; //  make sure cout is flushed.
+    //  The machine drifts between processes (clock boost, neighbours), and
+    //  every case slows together.  The median ratio over the cases measures
+    //  that drift; each case is judged with it divided out, and the drift
+    //  itself must stay within the threshold.
+    auto const drift = ratios.empty() ? 1.0 : regress::summarise(ratios).ms;
+    auto const drifted = drift > 1.0 + opts.threshold / 100.0;
+    failed = failed || drifted;
+
+    std::cout << konst::dot << '\n';
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "drift: x"s << drift << (drifted ? "  REGRESSION"s : "  ok"s) << '\n';
+    for (std::size_t cx { 0 }; cx < pairs.size(); ++cx) {
+      auto const & name = current.timings[cx].first;
+      auto const & [tm, base] = pairs[cx];
+      if (base == nullptr) {
+        std::cout << std::left << std::setw(16) << name << std::right
+                  << " NO BASELINE\n"s;
+        failed = true;
+        continue;
+      }
+      //  a slow-down must clear both the threshold and the noise of either run.
+      auto const ms = tm.ms / drift;
+      auto const limit = base->ms * (1.0 + opts.threshold / 100.0);
+      auto const noise = std::max(base->ms * opts.floor / 100.0,
+                                  3.0 * std::max(base->spread, tm.spread / drift));
+      auto const regressed = ms > limit && ms - base->ms > noise;
+      failed = failed || regressed;
+      std::cout << std::left << std::setw(16) << name << std::right
+                << std::setw(12) << base->ms << " ms -> "s
+                << std::setw(12) << tm.ms << " ms"s
+                << " ("s << std::setw(10) << ms << " ms)"s
+                << (regressed ? "  REGRESSION"s : "  ok"s) << '\n';
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+  }
 
-  return 0;
+  std::cout << (failed ? "FAILED"s : "PASSED"s) << std::endl;
 
+  return failed ? 1 : 0;
 }